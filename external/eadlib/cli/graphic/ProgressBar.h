@@ -189,6 +189,9 @@ namespace eadlib {
          * @return Progress bar cursor position
          */
         inline size_t ProgressBar::calcPosition() const {
+            if( _total_steps == 0 ) { //single step bar
+                return _bar_width;
+            }
             return _current_step * _bar_width / _total_steps;
         }
 
@@ -197,6 +200,9 @@ namespace eadlib {
          * @return Percentage completed
          */
         inline double ProgressBar::calcPercentage() const {
+            if( _total_steps == 0 ) { //single step bar
+                return 100;
+            }
             return (double) _current_step * 100 / _total_steps;
         }
 
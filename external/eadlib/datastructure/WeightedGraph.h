@@ -28,6 +28,7 @@ namespace eadlib {
             std::list<T>  childrenList = std::list<T>();  //directed edge
             EdgeWeights_t weight       = EdgeWeights_t(); //weight of edges
             std::list<T>  parentsList  = std::list<T>();  //reverse lookup of directed edge
+            size_t        id           = 0;               //node ID given on first insertion
         };
         typedef std::unordered_map<T, NodeAdjacency> Graph_t;
         //Constructors/Destructor
@@ -64,6 +65,11 @@ namespace eadlib {
         size_t getOutDegree( const T &node ) const;
         size_t getInDegree_weighted( const T &node );
         size_t getOutDegree_weighted( const T &node );
+        //Node IDs
+        size_t getNodeID( const T &node ) const;
+        bool hasDenseNodeIDs() const;
+        void compactNodeIDs();
+        bool renumberNodes( const std::vector<size_t> &new_ids );
         void setName( const std::string &name );
         std::string getName() const;
         //Print out
@@ -73,8 +79,10 @@ namespace eadlib {
       protected:
         bool checkNodesExist( const T &a, const T &b ) const;
         template <class U> bool checkOverflow( U a, U b ) const;
+        bool insertNode( const T &node );
         Graph_t     _adjacencyList;
         size_t      _edgeCount;
+        size_t      _nextID;
         std::string _name;
     };
 
@@ -86,6 +94,7 @@ namespace eadlib {
      */
     template<class T> WeightedGraph<T>::WeightedGraph( const std::string &name ) :
         _edgeCount( 0 ),
+        _nextID( 0 ),
         _name( name )
     {}
 
@@ -95,10 +104,11 @@ namespace eadlib {
      */
     template<class T> WeightedGraph<T>::WeightedGraph( std::initializer_list<T> list ) :
         _edgeCount( 0 ),
+        _nextID( 0 ),
         _name( "wgraph" )
     {
         for( typename std::initializer_list<T>::iterator it = list.begin(); it != list.end(); ++it ) {
-            _adjacencyList.insert( typename Graph_t::value_type( *it, NodeAdjacency() ) );
+            insertNode( *it );
         }
     }
 
@@ -107,8 +117,9 @@ namespace eadlib {
      * @param graph Graph
      */
     template<class T> WeightedGraph<T>::WeightedGraph( const WeightedGraph<T> &graph ) :
-        _edgeCount( graph._edgeCount ),
         _adjacencyList( graph._adjacencyList ),
+        _edgeCount( graph._edgeCount ),
+        _nextID( graph._nextID ),
         _name( graph._name )
     {}
 
@@ -117,8 +128,9 @@ namespace eadlib {
      * @param graph Graph
      */
     template<class T> WeightedGraph<T>::WeightedGraph( WeightedGraph<T> &&graph ) :
-        _edgeCount( graph._edgeCount ),
         _adjacencyList( graph._adjacencyList ),
+        _edgeCount( graph._edgeCount ),
+        _nextID( graph._nextID ),
         _name( graph._name )
     {}
 
@@ -260,8 +272,8 @@ namespace eadlib {
             throw std::overflow_error( "Total edge weight has reached the limit of size_t type." );
         }
         //Node creation if missing
-        _adjacencyList.insert( typename Graph_t::value_type( from, NodeAdjacency() ) );
-        _adjacencyList.insert( typename Graph_t::value_type( to, NodeAdjacency() ) );
+        insertNode( from );
+        insertNode( to );
         //Checking/Inserting 'to' node in children list of 'from'
         auto search_to = std::find( _adjacencyList.at( from ).childrenList.begin(),
                                     _adjacencyList.at( from ).childrenList.end(),
@@ -301,8 +313,8 @@ namespace eadlib {
             throw std::overflow_error( "Total graph edge count would reach the limit of size_t type with the given edge weight." );
         }
         //Node creation if missing
-        _adjacencyList.insert( typename Graph_t::value_type( from, NodeAdjacency() ) );
-        _adjacencyList.insert( typename Graph_t::value_type( to, NodeAdjacency() ) );
+        insertNode( from );
+        insertNode( to );
         //Checking/Inserting 'to' node in children list of 'from'
         auto search_to = std::find( _adjacencyList.at( from ).childrenList.begin(),
                                     _adjacencyList.at( from ).childrenList.end(),
@@ -411,7 +423,7 @@ namespace eadlib {
     template<class T> bool WeightedGraph<T>::addNode( const T &node ) {
         auto search = _adjacencyList.find( node );
         if( search == _adjacencyList.end() ) {
-            _adjacencyList.insert( typename Graph_t::value_type( node, NodeAdjacency() ) );
+            insertNode( node );
             return true;
         } else {
             LOG_ERROR( "[eadlib::WeightedGraph<T>::addNode( ", node, " )] Node is already in graph." );
@@ -659,6 +671,68 @@ namespace eadlib {
         return edge_counter;
     }
 
+    /**
+     * Gets the ID of a node
+     * (IDs are given in insertion order and are dense unless nodes have been deleted - see compactNodeIDs())
+     * @param node Node
+     * @return Node ID
+     * @throws std::out_of_range when node specified is not in the graph
+     */
+    template<class T> size_t WeightedGraph<T>::getNodeID( const T &node ) const {
+        return at( node ).id;
+    }
+
+    /**
+     * Checks if the node IDs cover [0, nodeCount()) without gaps
+     * @return Dense state
+     */
+    template<class T> bool WeightedGraph<T>::hasDenseNodeIDs() const {
+        return _nextID == _adjacencyList.size();
+    }
+
+    /**
+     * Renumbers the node IDs so they cover [0, nodeCount()) again, keeping their relative order
+     */
+    template<class T> void WeightedGraph<T>::compactNodeIDs() {
+        if( hasDenseNodeIDs() ) {
+            return;
+        }
+        std::vector<NodeAdjacency *> slots( _nextID, nullptr );
+        for( auto &node : _adjacencyList ) {
+            slots[ node.second.id ] = &node.second;
+        }
+        _nextID = 0;
+        for( auto slot : slots ) {
+            if( slot != nullptr ) {
+                slot->id = _nextID++;
+            }
+        }
+    }
+
+    /**
+     * Renumbers the node IDs
+     * @param new_ids New ID for each current node ID (must be a permutation of [0, nodeCount()))
+     * @return Success
+     */
+    template<class T> bool WeightedGraph<T>::renumberNodes( const std::vector<size_t> &new_ids ) {
+        if( !hasDenseNodeIDs() || new_ids.size() != _adjacencyList.size() ) {
+            LOG_ERROR( "[eadlib::WeightedGraph<T>::renumberNodes( <std::vector<size_t>> )] ID mapping does not match the graph's dense IDs." );
+            return false;
+        }
+        std::vector<bool> taken( new_ids.size(), false );
+        for( auto id : new_ids ) {
+            if( id >= taken.size() || taken[ id ] ) {
+                LOG_ERROR( "[eadlib::WeightedGraph<T>::renumberNodes( <std::vector<size_t>> )] ID mapping is not a permutation." );
+                return false;
+            }
+            taken[ id ] = true;
+        }
+        for( auto &node : _adjacencyList ) {
+            node.second.id = new_ids[ node.second.id ];
+        }
+        return true;
+    }
+
     /**
      * Sets the name of the Graph
      * @param name Name of Graph
@@ -712,6 +786,19 @@ namespace eadlib {
         return out;
     }
 
+    /**
+     * Inserts a node if not already in the graph and gives it the next node ID
+     * @param node Node
+     * @return Inserted state (false if already present)
+     */
+    template<class T> bool WeightedGraph<T>::insertNode( const T &node ) {
+        auto result = _adjacencyList.insert( typename Graph_t::value_type( node, NodeAdjacency() ) );
+        if( result.second ) {
+            result.first->second.id = _nextID++;
+        }
+        return result.second;
+    }
+
     /**
      * Check nodes exists
      * @param from Origin node
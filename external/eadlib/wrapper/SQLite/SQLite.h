@@ -3,7 +3,7 @@
     @brief          SQLite database wrapper to simplify usage of sqlite3
     @dependencies   eadlib::TableDB, eadlib::TableDBCell, eadlib::TableDBRow,
                     eadlib::TableDBCol, eadlib::TableDBCursor, eadlib::logger::Logger,
-                    sqlite3
+                    eadlib::wrapper::SQLiteStatement, sqlite3
     @author         E. A. Davison
     @copyright      E. A. Davison 2016
     @license        GNUv2 Public License
@@ -17,6 +17,7 @@
 #include "eadlib/logger/Logger.h"
 #include "sqlite3/sqlite3.h"
 #include "TableDB.h"
+#include "SQLiteStatement.h"
 
 namespace eadlib {
     namespace wrapper {
@@ -29,12 +30,16 @@ namespace eadlib {
             SQLite & operator =( const SQLite &rhs ) = delete;
             SQLite & operator =( SQLite &&rhs ) noexcept;
             bool open( const std::string &file_name );
+            bool openReadOnly( const std::string &file_name );
             std::string getFileName() const;
             bool close();
             bool connected() const;
             size_t pull( const std::string &query, TableDB &table );
             bool   push( const std::string &query );
             bool   pullMetaData( const std::string &table_name, TableDB &table );
+            bool   prepare( const std::string &query, SQLiteStatement &statement );
+            bool   backup( const std::string &file_name );
+            bool   restore( const std::string &file_name );
           private:
             //Variables
             bool _connected_flag;
@@ -42,9 +47,11 @@ namespace eadlib {
             std::string _file_name;
             //Methods
             bool connect( const std::string &file_name );
+            bool connect( const std::string &file_name, const int &flags );
             bool disconnect();
             size_t queryPull( const std::string &query, TableDB &table );
             bool queryPush( const std::string &query );
+            bool copy( sqlite3 *source, sqlite3 *destination, const std::string &file_name );
             TableDBCell::DataType getItemType( int type ) const;
             //Error code handling
             bool sqlMsgCode( int code );
@@ -110,6 +117,23 @@ namespace eadlib {
             return _connected_flag;
         }
 
+        /**
+         * Connects to database file in read-only mode
+         * (the connection is not shared between threads so several can be used concurrently on the same file)
+         * @param file_name File name
+         * @return Success
+         */
+        inline bool SQLite::openReadOnly( const std::string &file_name ) {
+            if( _connected_flag ) {
+                _connected_flag = disconnect();
+            }
+            _connected_flag = connect( file_name, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX );
+            if( connected() ) {
+                _file_name = file_name;
+            }
+            return _connected_flag;
+        }
+
         /**
          * Gets the file name of the currently opened database
          * @return File name
@@ -186,9 +210,83 @@ namespace eadlib {
             }
         }
 
+        /**
+         * Compiles a query into a reusable statement bound to this connection
+         * (the statement must be finalized before the connection is closed)
+         * @param query     SQLite query with '?' parameter placeholders
+         * @param statement SQLiteStatement container
+         * @return Success
+         */
+        inline bool SQLite::prepare( const std::string &query, SQLiteStatement &statement ) {
+            if( !connected() ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLite::prepare( '", query, "', <SQLiteStatement> )] Database file not opened." );
+                return false;
+            } else {
+                return statement.prepare( _database, query );
+            }
+        }
+
+        /**
+         * Copies the whole of the currently opened database into a database file
+         * (uses the online backup API - the file's previous content is replaced)
+         * @param file_name Destination database file name
+         * @return Success
+         */
+        inline bool SQLite::backup( const std::string &file_name ) {
+            if( !connected() ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLite::backup( ", file_name, " )] Database file not opened." );
+                return false;
+            }
+            sqlite3 *file_database { nullptr };
+            bool success = !sqlMsgCode( sqlite3_open( file_name.c_str(), &file_database ) )
+                           && copy( _database, file_database, file_name );
+            sqlite3_close( file_database );
+            return success;
+        }
+
+        /**
+         * Copies the whole of a database file into the currently opened database
+         * (uses the online backup API - the opened database's previous content is replaced)
+         * @param file_name Source database file name
+         * @return Success
+         */
+        inline bool SQLite::restore( const std::string &file_name ) {
+            if( !connected() ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLite::restore( ", file_name, " )] Database file not opened." );
+                return false;
+            }
+            sqlite3 *file_database { nullptr };
+            bool success = !sqlMsgCode( sqlite3_open_v2( file_name.c_str(), &file_database, SQLITE_OPEN_READONLY, nullptr ) )
+                           && copy( file_database, _database, file_name );
+            sqlite3_close( file_database );
+            return success;
+        }
+
         //-----------------------------------------------------------------------------------------------------------------
         // SQLite class private method implementations
         //-----------------------------------------------------------------------------------------------------------------
+        /**
+         * Copies all pages of a database connection's main database into another in one step
+         * @param source      Source connection
+         * @param destination Destination connection
+         * @param file_name   File name of the database on disk (for logging)
+         * @return Success
+         */
+        inline bool SQLite::copy( sqlite3 *source, sqlite3 *destination, const std::string &file_name ) {
+            sqlite3_backup *backup = sqlite3_backup_init( destination, "main", source, "main" );
+            if( backup == nullptr ) {
+                sqlMsgCode( sqlite3_errcode( destination ), "backup init (" + file_name + ")" );
+                return false;
+            }
+            int step_code = sqlite3_backup_step( backup, -1 );
+            int finish_code = sqlite3_backup_finish( backup );
+            if( step_code != SQLITE_DONE || sqlMsgCode( finish_code, "backup (" + file_name + ")" ) ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLite::copy( <sqlite3>, <sqlite3>, ", file_name, " )] Backup step failed (code ", step_code, ")." );
+                return false;
+            }
+            return true;
+        }
+
         /**
          * Opens a connection to a SQLite database file
          * @param file_name File name
@@ -198,6 +296,16 @@ namespace eadlib {
             return !( sqlMsgCode( sqlite3_open( file_name.c_str(), &_database ) ) );
         }
 
+        /**
+         * Opens a connection to a SQLite database file with specific open flags
+         * @param file_name File name
+         * @param flags     sqlite3_open_v2 flags
+         * @return Success
+         */
+        inline bool SQLite::connect( const std::string &file_name, const int &flags ) {
+            return !( sqlMsgCode( sqlite3_open_v2( file_name.c_str(), &_database, flags, nullptr ) ) );
+        }
+
         /**
          * Closes the current connection
          * @return Success
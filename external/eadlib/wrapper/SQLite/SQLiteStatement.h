@@ -0,0 +1,368 @@
+/**
+    @class          eadlib::wrapper::SQLiteStatement
+    @brief          Reusable prepared statement for the eadlib::wrapper::SQLite wrapper
+
+                    Wraps a sqlite3_stmt so that a query can be parsed once and then
+                    bound/executed many times. Rows returned by a query can be read
+                    one at a time straight from the statement without going through
+                    a TableDB container.
+
+    @dependencies   eadlib::logger::Logger, sqlite3
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2017
+    @license        GNUv2 Public License
+**/
+#ifndef EADLIB_SQLITESTATEMENT_H
+#define EADLIB_SQLITESTATEMENT_H
+
+#include <string>
+#include "eadlib/logger/Logger.h"
+#include "sqlite3/sqlite3.h"
+
+namespace eadlib {
+    namespace wrapper {
+        class SQLiteStatement {
+          public:
+            SQLiteStatement();
+            SQLiteStatement( const SQLiteStatement &statement ) = delete;
+            SQLiteStatement( SQLiteStatement &&statement ) noexcept;
+            ~SQLiteStatement();
+            SQLiteStatement & operator =( const SQLiteStatement &rhs ) = delete;
+            SQLiteStatement & operator =( SQLiteStatement &&rhs ) noexcept;
+            bool prepare( sqlite3 *database, const std::string &query );
+            bool finalize();
+            bool isPrepared() const;
+            std::string getQuery() const;
+            int getParameterCount() const;
+            //Parameter binding (indices start at 1)
+            bool bindInt( const int &index, const sqlite3_int64 &value );
+            bool bindDouble( const int &index, const double &value );
+            bool bindText( const int &index, const std::string &value );
+            bool bindBlob( const int &index, const void *data, const size_t &size );
+            bool bindNull( const int &index );
+            //Execution
+            bool execute();
+            bool fetch();
+            bool reset();
+            bool hasError() const;
+            //Row access (indices start at 0)
+            int getColumnCount() const;
+            int getColumnType( const int &col ) const;
+            sqlite3_int64 getInt( const int &col ) const;
+            double getDouble( const int &col ) const;
+            std::string getString( const int &col ) const;
+            const unsigned char * getBlob( const int &col, size_t &size ) const;
+          private:
+            bool bindCheck( const int &code, const int &index );
+            sqlite3_stmt * _statement;
+            std::string    _query;
+            bool           _error_flag;
+        };
+
+        //-----------------------------------------------------------------------------------------------------------------
+        // SQLiteStatement class public method implementations
+        //-----------------------------------------------------------------------------------------------------------------
+        /**
+         * Constructor
+         */
+        inline SQLiteStatement::SQLiteStatement() :
+            _statement( nullptr ),
+            _query( "" ),
+            _error_flag( false )
+        {}
+
+        /**
+         * Move-Constructor
+         * @param statement SQLiteStatement instance to move over
+         */
+        inline SQLiteStatement::SQLiteStatement( SQLiteStatement &&statement ) noexcept :
+            _statement( statement._statement ),
+            _query( std::move( statement._query ) ),
+            _error_flag( statement._error_flag )
+        {
+            statement._statement = nullptr;
+        }
+
+        /**
+         * Destructor
+         */
+        inline SQLiteStatement::~SQLiteStatement() {
+            finalize();
+        }
+
+        /**
+         * Move assignment operator
+         * @param rhs SQLiteStatement instance to move over
+         * @return Moved instance
+         */
+        inline SQLiteStatement & SQLiteStatement::operator =( SQLiteStatement &&rhs ) noexcept {
+            if( this != &rhs ) {
+                finalize();
+                _statement      = rhs._statement;
+                _query          = std::move( rhs._query );
+                _error_flag     = rhs._error_flag;
+                rhs._statement  = nullptr;
+            }
+            return *this;
+        }
+
+        /**
+         * Compiles a query into a reusable statement
+         * (any previously prepared statement is finalized first)
+         * @param database Database connection handle
+         * @param query    SQL query string with '?' parameter placeholders
+         * @return Success
+         */
+        inline bool SQLiteStatement::prepare( sqlite3 *database, const std::string &query ) {
+            finalize();
+            _query      = query;
+            _error_flag = false;
+            int code = sqlite3_prepare_v2( database, query.c_str(), -1, &_statement, nullptr );
+            if( code != SQLITE_OK ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLiteStatement::prepare( '", query, "' )] ", sqlite3_errmsg( database ) );
+                sqlite3_finalize( _statement );
+                _statement  = nullptr;
+                _error_flag = true;
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * Destroys the compiled statement
+         * @return Success
+         */
+        inline bool SQLiteStatement::finalize() {
+            if( _statement != nullptr ) {
+                int code = sqlite3_finalize( _statement );
+                _statement = nullptr;
+                return code == SQLITE_OK;
+            }
+            return true;
+        }
+
+        /**
+         * Checks if the statement is ready to be used
+         * @return Prepared state
+         */
+        inline bool SQLiteStatement::isPrepared() const {
+            return _statement != nullptr;
+        }
+
+        /**
+         * Gets the query string the statement was prepared with
+         * @return Query string
+         */
+        inline std::string SQLiteStatement::getQuery() const {
+            return _query;
+        }
+
+        /**
+         * Gets the number of parameters in the prepared statement
+         * @return Number of '?' parameters
+         */
+        inline int SQLiteStatement::getParameterCount() const {
+            return _statement != nullptr ? sqlite3_bind_parameter_count( _statement ) : 0;
+        }
+
+        /**
+         * Binds an integer to a parameter
+         * @param index Parameter index (1-based)
+         * @param value Value
+         * @return Success
+         */
+        inline bool SQLiteStatement::bindInt( const int &index, const sqlite3_int64 &value ) {
+            return bindCheck( sqlite3_bind_int64( _statement, index, value ), index );
+        }
+
+        /**
+         * Binds a floating point number to a parameter
+         * @param index Parameter index (1-based)
+         * @param value Value
+         * @return Success
+         */
+        inline bool SQLiteStatement::bindDouble( const int &index, const double &value ) {
+            return bindCheck( sqlite3_bind_double( _statement, index, value ), index );
+        }
+
+        /**
+         * Binds a string to a parameter
+         * (the string is copied by SQLite so it does not need to outlive the call)
+         * @param index Parameter index (1-based)
+         * @param value Value
+         * @return Success
+         */
+        inline bool SQLiteStatement::bindText( const int &index, const std::string &value ) {
+            return bindCheck( sqlite3_bind_text( _statement, index, value.c_str(), static_cast<int>( value.size() ), SQLITE_TRANSIENT ), index );
+        }
+
+        /**
+         * Binds a binary blob to a parameter
+         * (the data is copied by SQLite so it does not need to outlive the call)
+         * @param index Parameter index (1-based)
+         * @param data  Pointer to the data
+         * @param size  Size of the data in bytes
+         * @return Success
+         */
+        inline bool SQLiteStatement::bindBlob( const int &index, const void *data, const size_t &size ) {
+            return bindCheck( sqlite3_bind_blob( _statement, index, data, static_cast<int>( size ), SQLITE_TRANSIENT ), index );
+        }
+
+        /**
+         * Binds NULL to a parameter
+         * @param index Parameter index (1-based)
+         * @return Success
+         */
+        inline bool SQLiteStatement::bindNull( const int &index ) {
+            return bindCheck( sqlite3_bind_null( _statement, index ), index );
+        }
+
+        /**
+         * Runs a statement that returns no data and resets it for the next use
+         * @return Success
+         */
+        inline bool SQLiteStatement::execute() {
+            if( _statement == nullptr ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLiteStatement::execute()] Statement not prepared." );
+                return false;
+            }
+            int code = sqlite3_step( _statement );
+            while( code == SQLITE_ROW ) {
+                code = sqlite3_step( _statement );
+            }
+            bool success = ( code == SQLITE_DONE );
+            if( !success ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLiteStatement::execute()] ", sqlite3_errmsg( sqlite3_db_handle( _statement ) ), ": ", _query );
+                _error_flag = true;
+            }
+            sqlite3_reset( _statement );
+            sqlite3_clear_bindings( _statement );
+            return success;
+        }
+
+        /**
+         * Steps the statement to the next row of its result
+         * @return Row available state (false when done or on error - see hasError())
+         */
+        inline bool SQLiteStatement::fetch() {
+            if( _statement == nullptr ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLiteStatement::fetch()] Statement not prepared." );
+                _error_flag = true;
+                return false;
+            }
+            int code = sqlite3_step( _statement );
+            if( code == SQLITE_ROW ) {
+                return true;
+            }
+            if( code != SQLITE_DONE ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLiteStatement::fetch()] ", sqlite3_errmsg( sqlite3_db_handle( _statement ) ), ": ", _query );
+                _error_flag = true;
+            }
+            return false;
+        }
+
+        /**
+         * Resets the statement so that it can be re-run (bindings are cleared)
+         * @return Success
+         */
+        inline bool SQLiteStatement::reset() {
+            if( _statement == nullptr ) {
+                return false;
+            }
+            sqlite3_reset( _statement );
+            sqlite3_clear_bindings( _statement );
+            _error_flag = false;
+            return true;
+        }
+
+        /**
+         * Checks if an error occurred since the last preparation/reset
+         * @return Error state
+         */
+        inline bool SQLiteStatement::hasError() const {
+            return _error_flag;
+        }
+
+        /**
+         * Gets the number of columns in the result rows
+         * @return Column count
+         */
+        inline int SQLiteStatement::getColumnCount() const {
+            return _statement != nullptr ? sqlite3_column_count( _statement ) : 0;
+        }
+
+        /**
+         * Gets the SQLite type code of a column in the current row
+         * @param col Column index (0-based)
+         * @return SQLite type code (SQLITE_INTEGER, SQLITE_FLOAT, SQLITE_TEXT, SQLITE_BLOB, SQLITE_NULL)
+         */
+        inline int SQLiteStatement::getColumnType( const int &col ) const {
+            return sqlite3_column_type( _statement, col );
+        }
+
+        /**
+         * Gets an integer from a column of the current row
+         * @param col Column index (0-based)
+         * @return Value
+         */
+        inline sqlite3_int64 SQLiteStatement::getInt( const int &col ) const {
+            return sqlite3_column_int64( _statement, col );
+        }
+
+        /**
+         * Gets a floating point number from a column of the current row
+         * @param col Column index (0-based)
+         * @return Value
+         */
+        inline double SQLiteStatement::getDouble( const int &col ) const {
+            return sqlite3_column_double( _statement, col );
+        }
+
+        /**
+         * Gets a string from a column of the current row
+         * @param col Column index (0-based)
+         * @return Value
+         */
+        inline std::string SQLiteStatement::getString( const int &col ) const {
+            auto text = sqlite3_column_text( _statement, col );
+            if( text == nullptr ) {
+                return "";
+            }
+            return std::string( reinterpret_cast<const char *>( text ),
+                                static_cast<size_t>( sqlite3_column_bytes( _statement, col ) ) );
+        }
+
+        /**
+         * Gets a blob from a column of the current row
+         * (pointer is valid until the statement is stepped, reset or finalized)
+         * @param col  Column index (0-based)
+         * @param size Container for the size of the blob in bytes
+         * @return Pointer to the blob data
+         */
+        inline const unsigned char * SQLiteStatement::getBlob( const int &col, size_t &size ) const {
+            auto data = static_cast<const unsigned char *>( sqlite3_column_blob( _statement, col ) );
+            size = static_cast<size_t>( sqlite3_column_bytes( _statement, col ) );
+            return data;
+        }
+
+        //-----------------------------------------------------------------------------------------------------------------
+        // SQLiteStatement class private method implementations
+        //-----------------------------------------------------------------------------------------------------------------
+        /**
+         * Checks the return code of a parameter binding
+         * @param code  SQLite return code
+         * @param index Parameter index
+         * @return Success
+         */
+        inline bool SQLiteStatement::bindCheck( const int &code, const int &index ) {
+            if( code != SQLITE_OK ) {
+                LOG_ERROR( "[eadlib::wrapper::SQLiteStatement::bindCheck( ", code, ", ", index, " )] Could not bind parameter: ", _query );
+                _error_flag = true;
+                return false;
+            }
+            return true;
+        }
+    }
+}
+
+#endif //EADLIB_SQLITESTATEMENT_H
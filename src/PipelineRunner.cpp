@@ -59,6 +59,23 @@ void sbp::PipelineRunner::compressGraph( eadlib::WeightedGraph<std::string> &gra
     std::cout << "           " << graph.size() << " edges in graph." << std::endl;
 }
 
+/**
+ * Renumbers the graph's nodes so that neighbours get close IDs
+ * @param graph Graph instance
+ */
+void sbp::PipelineRunner::reorderGraph( eadlib::WeightedGraph<std::string> &graph ) {
+    std::cout << "-> Renumbering graph nodes for locality..." << std::endl;
+    auto before = sbp::algo::NodeOrdering::edgeSpan( graph );
+    auto ordering = sbp::algo::NodeOrdering( graph );
+    if( !ordering.reorder() ) {
+        std::cerr << "Error: Could not renumber the graph nodes." << std::endl;
+        return;
+    }
+    auto after = sbp::algo::NodeOrdering::edgeSpan( graph );
+    std::cout << "-> Edge span (mean/max): " << before._mean << "/" << before._max
+              << " -> " << after._mean << "/" << after._max << std::endl;
+}
+
 /**
  * Exports a graph to a Dot file format
  * @param file_name File name of the dot file
@@ -89,43 +106,146 @@ void sbp::PipelineRunner::exportToDot( const std::string &file_name, eadlib::Wei
  * Indexes and saves K-mer graph into Database
  * @param db_file_name Database file name
  * @param graph        Graph instance
+ * @param schema       Storage layout to use in the database
  */
-void sbp::PipelineRunner::exportToDB( const std::string &db_file_name, eadlib::WeightedGraph<std::string> &graph ) {
+void sbp::PipelineRunner::exportToDB( const std::string &db_file_name,
+                                      eadlib::WeightedGraph<std::string> &graph,
+                                      const sbp::io::StorageSchema &schema ) {
     auto db = sbp::io::Database();
     if( db.open( db_file_name ) ) {
         std::cout << "-> Storing into database..." << std::endl;
         auto graph_indexer = sbp::graph::GraphIndexer( db );
-        graph_indexer.storeIntoDB( graph.getName(), graph );
+        graph_indexer.storeIntoDB( graph.getName(), graph, schema );
         db.close();
     }
 }
 
 /**
- * Loads up an indexed version of the graph from the database
+ * Indexes the K-mer graph in memory into a dense integer ID graph
+ * @param graph       K-mer graph instance
+ * @param index_graph Index graph instance to fill
+ * @param kmers       Container for the K-mer string of each node ID
+ */
+void sbp::PipelineRunner::indexGraph( const eadlib::WeightedGraph<std::string> &graph,
+                                      eadlib::WeightedGraph<size_t> &index_graph,
+                                      std::vector<std::string> &kmers ) {
+    std::cout << "-> Indexing graph..." << std::endl;
+    sbp::graph::GraphIndexer::indexGraph( graph, index_graph, kmers );
+    std::cout << "-> Result: " << index_graph.nodeCount() << " nodes in graph." << std::endl;
+    std::cout << "           " << index_graph.size() << " edges in graph." << std::endl;
+}
+
+/**
+ * Saves an indexed graph into the database and writes its snapshot in the background
+ * (the index graph and kmers must stay untouched until the returned future is ready;
+ *  nothing is printed from the background thread, errors go to the log)
+ * @param db_file_name       Database file name
+ * @param snapshot_file_name Snapshot file name
+ * @param index_graph        Index graph instance
+ * @param kmers              K-mer string of each node ID
+ * @param schema             Storage layout to use in the database
+ * @return Future success state of the export
+ */
+std::future<bool> sbp::PipelineRunner::exportToDBAsync( const std::string &db_file_name,
+                                                        const std::string &snapshot_file_name,
+                                                        const eadlib::WeightedGraph<size_t> &index_graph,
+                                                        const std::vector<std::string> &kmers,
+                                                        const sbp::io::StorageSchema &schema ) {
+    std::cout << "-> Storing into database (background)..." << std::endl;
+    return std::async( std::launch::async, [=, &index_graph, &kmers]() {
+        auto db = sbp::io::Database();
+        if( !db.open( db_file_name ) ) {
+            return false;
+        }
+        auto graph_indexer = sbp::graph::GraphIndexer( db );
+        bool success = graph_indexer.storeIntoDB( index_graph.getName(), index_graph, kmers, schema );
+        if( success && sbp::io::GraphSnapshot::write( snapshot_file_name, index_graph, kmers ) ) {
+            db.setMetadata( index_graph.getName(), "snapshot", snapshot_file_name );
+        }
+        db.close();
+        return success;
+    } );
+}
+
+/**
+ * Appends the reads of a FASTA file to a graph stored in the database
+ * @param db_file_name    Database file name
+ * @param graph_name      Name of the stored graph
+ * @param fasta_file_path Path and name of the FASTA file with the new sequencer reads inside
+ * @param kmer_size       Number of characters of a K-mer (must match the stored graph's)
+ * @return Success
+ */
+bool sbp::PipelineRunner::appendToDB( const std::string &db_file_name,
+                                      const std::string &graph_name,
+                                      const std::string &fasta_file_path,
+                                      const size_t &kmer_size ) {
+    auto db = sbp::io::Database();
+    if( !db.open( db_file_name ) ) {
+        return false;
+    }
+    if( !db.exists( graph_name ) ) {
+        std::cerr << "Error: Graph '" << graph_name << "' not found in the database." << std::endl;
+        return false;
+    }
+    auto delta = eadlib::WeightedGraph<std::string>( graph_name );
+    loadFASTA( fasta_file_path, kmer_size, delta );
+    std::cout << "-> Appending reads to graph '" << graph_name << "'..." << std::endl;
+    auto appender = sbp::graph::GraphAppender( db );
+    bool success = appender.append( graph_name, kmer_size, delta );
+    db.close();
+    return success;
+}
+
+/**
+ * Loads up an indexed version of the graph from its snapshot or, failing that, from the database
  * @param db_file_name Database file name
  * @param graph        Graph instance
+ * @return Success
  */
-void sbp::PipelineRunner::importFromDB( const std::string &db_file_name, eadlib::WeightedGraph<size_t> &graph ) {
+bool sbp::PipelineRunner::importFromDB( const std::string &db_file_name, eadlib::WeightedGraph<size_t> &graph ) {
     auto db = sbp::io::Database();
-    if( db.open( db_file_name ) ) {
+    if( !db.open( db_file_name ) ) {
+        std::cerr << "Error: Could not open database '" << db_file_name << "'." << std::endl;
+        return false;
+    }
+    auto snapshot = sbp::io::GraphSnapshot();
+    auto snapshot_file_name = db.getMetadata( graph.getName(), "snapshot" );
+    bool success { false };
+    if( !snapshot_file_name.empty() && snapshot.open( snapshot_file_name ) ) {
+        std::cout << "-> Loading indexed graph from snapshot '" << snapshot_file_name << "'..." << std::endl;
+        success = snapshot.loadGraph( graph );
+    }
+    if( !success ) {
         std::cout << "-> Loading indexed graph..." << std::endl;
-        db.loadGraph( graph.getName(), graph );
-        db.close();
-        std::cout << "-> Result: " << graph.nodeCount() << " nodes in graph." << std::endl;
-        std::cout << "           " << graph.size() << " edges in graph." << std::endl;
+        success = db.loadGraph( graph.getName(), graph );
+    }
+    db.close();
+    if( !success ) {
+        std::cerr << "Error: Could not load graph '" << graph.getName() << "' from the database." << std::endl;
+        return false;
     }
+    std::cout << "-> Result: " << graph.nodeCount() << " nodes in graph." << std::endl;
+    std::cout << "           " << graph.size() << " edges in graph." << std::endl;
+    return true;
 }
 
 /**
- * Loads up a kmer string version of the graph from the database
+ * Loads up a kmer string version of the graph from its snapshot or, failing that, from the database
  * @param db_file_name Database file name
  * @param graph        Graph instance
  */
 void sbp::PipelineRunner::importFromDB( const std::string &db_file_name, eadlib::WeightedGraph<std::string> &graph ) {
     auto db = sbp::io::Database();
-    if( db.open( db_file_name ) ) {
-        std::cout << "-> Loading kmer graph..." << std::endl;
-        db.loadGraph( graph.getName(), graph );
+    if( db.openReadOnly( db_file_name ) ) {
+        auto snapshot = sbp::io::GraphSnapshot();
+        auto snapshot_file_name = db.getMetadata( graph.getName(), "snapshot" );
+        if( !snapshot_file_name.empty() && snapshot.open( snapshot_file_name ) && snapshot.hasLabels() ) {
+            std::cout << "-> Loading kmer graph from snapshot '" << snapshot_file_name << "'..." << std::endl;
+            snapshot.loadGraph( graph );
+        } else {
+            std::cout << "-> Loading kmer graph..." << std::endl;
+            db.loadGraph( graph.getName(), graph );
+        }
         db.close();
         std::cout << "-> Result: " << graph.nodeCount() << " nodes in graph." << std::endl;
         std::cout << "           " << graph.size() << " edges in graph." << std::endl;
@@ -133,14 +253,164 @@ void sbp::PipelineRunner::importFromDB( const std::string &db_file_name, eadlib:
 }
 
 /**
- * Runs the superbubble algorithms on the graph
+ * Looks for a graph stored from the same input and parameters
+ * @param db_file_name Database file name
+ * @param fingerprint  Input fingerprint
+ * @return Name of the cached graph (empty if none)
+ */
+std::string sbp::PipelineRunner::findCachedGraph( const std::string &db_file_name, const std::string &fingerprint ) {
+    if( fingerprint.empty() || !std::ifstream( db_file_name ).good() ) {
+        return "";
+    }
+    auto db = sbp::io::Database();
+    if( !db.openReadOnly( db_file_name ) ) {
+        return "";
+    }
+    auto graph_name = db.findGraph( "fingerprint", fingerprint );
+    db.close();
+    return graph_name;
+}
+
+/**
+ * Records the input fingerprint of a stored graph
+ * @param db_file_name Database file name
+ * @param graph_name   Name of the stored graph
+ * @param fingerprint  Input fingerprint
+ */
+void sbp::PipelineRunner::recordFingerprint( const std::string &db_file_name, const std::string &graph_name, const std::string &fingerprint ) {
+    auto db = sbp::io::Database();
+    if( fingerprint.empty() || !db.open( db_file_name ) ) {
+        return;
+    }
+    if( !db.setMetadata( graph_name, "fingerprint", fingerprint ) ) {
+        std::cerr << "Error: Could not record the input fingerprint of '" << graph_name << "'." << std::endl;
+    }
+    db.close();
+}
+
+/**
+ * Loads the indexed graph from its checkpoint
+ * @param checkpoint  Checkpoint store
+ * @param index_graph Index graph instance to load into (may be left partially loaded on failure)
+ * @param kmers       Container for the K-mer string of each node ID
+ * @return Success (false when there is no valid checkpoint of the graph)
+ */
+bool sbp::PipelineRunner::resumeIndexGraph( const sbp::io::Checkpoint &checkpoint,
+                                            eadlib::WeightedGraph<size_t> &index_graph,
+                                            std::vector<std::string> &kmers ) {
+    if( !checkpoint.load( index_graph, kmers ) ) {
+        kmers.clear();
+        return false;
+    }
+    std::cout << "-> Checkpoint: resuming from indexed graph '" << checkpoint.getFileName( sbp::io::Checkpoint::Stage::INDEX_GRAPH ) << "'." << std::endl;
+    std::cout << "-> Result: " << index_graph.nodeCount() << " nodes in graph." << std::endl;
+    std::cout << "           " << index_graph.size() << " edges in graph." << std::endl;
+    return true;
+}
+
+/**
+ * Checkpoints the indexed graph
+ * (any checkpoint of the later stages is dropped as it was made from an older graph)
+ * @param checkpoint  Checkpoint store
+ * @param index_graph Index graph instance
+ * @param kmers       K-mer string of each node ID
+ */
+void sbp::PipelineRunner::checkpointIndexGraph( const sbp::io::Checkpoint &checkpoint,
+                                                const eadlib::WeightedGraph<size_t> &index_graph,
+                                                const std::vector<std::string> &kmers ) {
+    checkpoint.clear();
+    if( !checkpoint.save( index_graph, kmers ) ) {
+        std::cerr << "Error: Could not checkpoint the indexed graph." << std::endl;
+    }
+}
+
+/**
+ * Runs the quasi-linear time superbubble algorithm on the graph
  * @param graph Graph instance
+ * @return Success
+ */
+bool sbp::PipelineRunner::runQLinearSuperbubble( const eadlib::WeightedGraph<size_t> &graph ) {
+    std::cout << "-> Running the quasi-linear time superbubble algorithm..." << std::endl;
+    auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
+    auto sb     = sbp::algo::SB_Driver( writer );
+    auto result = std::list<sbp::algo::container::SuperBubble>();
+    if( !sb.runQLinear( graph, result ) ) {
+        std::cerr << "Error: The quasi-linear time superbubble algorithm failed on '" << graph.getName() << "'." << std::endl;
+        return false;
+    }
+    std::cout << "-> Result: " << result.size() << " superbubbles found." << std::endl;
+    return true;
+}
+
+/**
+ * Runs the quasi-linear time superbubble algorithm on the graph resuming from/checkpointing its stages
+ * @param graph      Graph instance
+ * @param checkpoint Checkpoint store
+ * @return Success
  */
-void sbp::PipelineRunner::runSuperbubble( const eadlib::WeightedGraph<size_t> &graph ) {
+bool sbp::PipelineRunner::runQLinearSuperbubble( const eadlib::WeightedGraph<size_t> &graph, const sbp::io::Checkpoint &checkpoint ) {
+    std::cout << "-> Running the quasi-linear time superbubble algorithm..." << std::endl;
     auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
     auto sb     = sbp::algo::SB_Driver( writer );
-    auto result1 = std::list<sbp::algo::container::SuperBubble>();
-    //sb.runLinear( graph, result1 );
-    auto result2 = std::list<sbp::algo::container::SuperBubble>();
-    sb.runQLinear( graph, result2 );
+    auto result = std::list<sbp::algo::container::SuperBubble>();
+    if( !sb.runQLinear( graph, checkpoint, result ) ) {
+        std::cerr << "Error: The quasi-linear time superbubble algorithm failed on '" << graph.getName() << "' (checkpointed run)." << std::endl;
+        return false;
+    }
+    std::cout << "-> Result: " << result.size() << " superbubbles found." << std::endl;
+    return true;
+}
+
+/**
+ * Runs the linear time superbubble algorithm on the graph
+ * @param graph Graph instance
+ * @return Success
+ */
+bool sbp::PipelineRunner::runLinearSuperbubble( const eadlib::WeightedGraph<size_t> &graph ) {
+    std::cout << "-> Running the linear time superbubble algorithm..." << std::endl;
+    auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
+    auto sb     = sbp::algo::SB_Driver( writer );
+    auto result = std::list<sbp::algo::container::SuperBubble>();
+    if( !sb.runLinear( graph, result ) ) {
+        std::cerr << "Error: The linear time superbubble algorithm failed on '" << graph.getName() << "'." << std::endl;
+        return false;
+    }
+    std::cout << "-> Result: " << result.size() << " superbubbles found." << std::endl;
+    return true;
+}
+
+/**
+ * Runs the quadratic time reference superbubble algorithm on the graph
+ * @param graph Graph instance
+ * @return Success
+ */
+bool sbp::PipelineRunner::runQuadraticSuperbubble( const eadlib::WeightedGraph<size_t> &graph ) {
+    std::cout << "-> Running the quadratic time superbubble algorithm..." << std::endl;
+    auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
+    auto sb     = sbp::algo::SB_Driver( writer );
+    auto result = std::list<sbp::algo::container::SuperBubble>();
+    if( !sb.runQuadratic( graph, result ) ) {
+        std::cerr << "Error: The quadratic time superbubble algorithm failed on '" << graph.getName() << "'." << std::endl;
+        return false;
+    }
+    std::cout << "-> Result: " << result.size() << " superbubbles found." << std::endl;
+    return true;
+}
+
+/**
+ * Runs the dominator tree superbubble algorithm on the graph
+ * @param graph Graph instance
+ * @return Success
+ */
+bool sbp::PipelineRunner::runDominatorSuperbubble( const eadlib::WeightedGraph<size_t> &graph ) {
+    std::cout << "-> Running the dominator tree superbubble algorithm..." << std::endl;
+    auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
+    auto sb     = sbp::algo::SB_Driver( writer );
+    auto result = std::list<sbp::algo::container::SuperBubble>();
+    if( !sb.runDominators( graph, result ) ) {
+        std::cerr << "Error: The dominator tree superbubble algorithm failed on '" << graph.getName() << "'." << std::endl;
+        return false;
+    }
+    std::cout << "-> Result: " << result.size() << " superbubbles found." << std::endl;
+    return true;
 }
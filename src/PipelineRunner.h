@@ -1,6 +1,8 @@
 #ifndef SUPERBUBBLE_PERFORMANCE_PIPELINERUNNER_H
 #define SUPERBUBBLE_PERFORMANCE_PIPELINERUNNER_H
 
+#include <fstream>
+#include <future>
 #include <eadlib/io/FileReader.h>
 #include <eadlib/io/FileWriter.h>
 #include <eadlib/datastructure/WeightedGraph.h>
@@ -8,9 +10,14 @@
 #include "io/FastaParser.h"
 #include "io/DotExport.h"
 #include "io/Database.h"
+#include "io/GraphSnapshot.h"
+#include "io/Fingerprint.h"
+#include "io/Checkpoint.h"
 #include "graph/GraphConstructor.h"
 #include "graph/GraphIndexer.h"
+#include "graph/GraphAppender.h"
 #include "algorithm/GraphCompressor.h"
+#include "algorithm/NodeOrdering.h"
 #include "algorithm/Tarjan.h"
 #include "algorithm/superbubble/SB_Driver.h"
 #include "algorithm/superbubble/container/SuperBubble.h"
@@ -19,12 +26,39 @@ namespace sbp {
     struct PipelineRunner {
         void loadFASTA( const std::string &fasta_file_path, const size_t &kmer_size, eadlib::WeightedGraph<std::string> &graph );
         void compressGraph( eadlib::WeightedGraph<std::string> &graph );
+        void reorderGraph( eadlib::WeightedGraph<std::string> &graph );
         void exportToDot( const std::string &file_name, eadlib::WeightedGraph<std::string> &graph );
         void exportToDot( const std::string &file_name, eadlib::WeightedGraph<size_t> &graph );
-        void exportToDB( const std::string &db_file_name, eadlib::WeightedGraph<std::string> &graph );
-        void importFromDB( const std::string &db_file_name, eadlib::WeightedGraph<size_t> &graph );
+        void exportToDB( const std::string &db_file_name,
+                         eadlib::WeightedGraph<std::string> &graph,
+                         const sbp::io::StorageSchema &schema = sbp::io::StorageSchema::EDGE_ROWS );
+        void indexGraph( const eadlib::WeightedGraph<std::string> &graph,
+                         eadlib::WeightedGraph<size_t> &index_graph,
+                         std::vector<std::string> &kmers );
+        std::future<bool> exportToDBAsync( const std::string &db_file_name,
+                                           const std::string &snapshot_file_name,
+                                           const eadlib::WeightedGraph<size_t> &index_graph,
+                                           const std::vector<std::string> &kmers,
+                                           const sbp::io::StorageSchema &schema );
+        bool appendToDB( const std::string &db_file_name,
+                         const std::string &graph_name,
+                         const std::string &fasta_file_path,
+                         const size_t &kmer_size );
+        bool importFromDB( const std::string &db_file_name, eadlib::WeightedGraph<size_t> &graph );
         void importFromDB( const std::string &db_file_name, eadlib::WeightedGraph<std::string> &graph );
-        void runSuperbubble( const eadlib::WeightedGraph<size_t> &graph );
+        std::string findCachedGraph( const std::string &db_file_name, const std::string &fingerprint );
+        void recordFingerprint( const std::string &db_file_name, const std::string &graph_name, const std::string &fingerprint );
+        bool resumeIndexGraph( const sbp::io::Checkpoint &checkpoint,
+                               eadlib::WeightedGraph<size_t> &index_graph,
+                               std::vector<std::string> &kmers );
+        void checkpointIndexGraph( const sbp::io::Checkpoint &checkpoint,
+                                   const eadlib::WeightedGraph<size_t> &index_graph,
+                                   const std::vector<std::string> &kmers );
+        bool runQLinearSuperbubble( const eadlib::WeightedGraph<size_t> &graph );
+        bool runQLinearSuperbubble( const eadlib::WeightedGraph<size_t> &graph, const sbp::io::Checkpoint &checkpoint );
+        bool runLinearSuperbubble( const eadlib::WeightedGraph<size_t> &graph );
+        bool runQuadraticSuperbubble( const eadlib::WeightedGraph<size_t> &graph );
+        bool runDominatorSuperbubble( const eadlib::WeightedGraph<size_t> &graph );
     };
 }
 
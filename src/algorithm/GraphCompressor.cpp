@@ -9,6 +9,17 @@ sbp::algo::GraphCompressor::GraphCompressor( eadlib::WeightedGraph<std::string>
     _graph( graph )
 {}
 
+/**
+ * Constructor
+ * @param graph  de Bruijn graph to collapse
+ * @param frozen Nodes to keep as they are (they bound the chains but are never merged)
+ */
+sbp::algo::GraphCompressor::GraphCompressor( eadlib::WeightedGraph<std::string> &graph,
+                                             const std::unordered_set<std::string> &frozen ) :
+    _graph( graph ),
+    _frozen( frozen )
+{}
+
 /**
  * Destructor
  */
@@ -32,6 +43,7 @@ void sbp::algo::GraphCompressor::compress() {
         count++;
         ( progress++ ).printPercentBar( std::cout, 2 );
     }
+    _graph.compactNodeIDs(); //closes the ID gaps left by the merged nodes
     progress.complete().printPercentBar( std::cout, 2 );
     std::cout << std::endl;
 }
@@ -45,7 +57,7 @@ size_t sbp::algo::GraphCompressor::compress( const GraphIterator_t &node ) {
     size_t count { 0 };
     const GraphIterator_t start_node = seek( node, 0 ); //get to the top of the node chain that can be merged
     LOG_DEBUG( "[sbp::algo::GraphCompressor::compress( ", node->first, " )] Farthest upstream start point: '", start_node->first, "'." );
-    if( start_node->second.childrenList.size() == 1 ) {
+    if( start_node->second.childrenList.size() == 1 && !isFrozen( start_node ) ) {
         std::queue<GraphIterator_t> merge_queue;
         bool valid_candidate { true };
         GraphIterator_t current = start_node;
@@ -118,6 +130,9 @@ const sbp::algo::GraphCompressor::GraphIterator_t sbp::algo::GraphCompressor::se
 const sbp::algo::GraphCompressor::GraphIterator_t sbp::algo::GraphCompressor::seek( const GraphIterator_t &previous,
                                                                                     const GraphIterator_t &current,
                                                                                     const size_t &previous_weight ) const {
+    if( isFrozen( current ) ) {
+        return previous;
+    }
     if( current->second.parentsList.empty() || current->second.parentsList.size() > 1 ) {
         return previous;
     }
@@ -148,15 +163,19 @@ const sbp::algo::GraphCompressor::GraphIterator_t sbp::algo::GraphCompressor::se
  * @return Validation state
  */
 bool sbp::algo::GraphCompressor::validateCandidate( const GraphIterator_t &candidate, const size_t &upstream_weight ) {
-    return ( candidate->second.parentsList.size() == 1 &&
+    return ( !isFrozen( candidate ) &&
+        candidate->second.parentsList.size() == 1 &&
         ( ( candidate->second.childrenList.size() == 1 &&
             candidate->second.weight.at( candidate->second.childrenList.front() ) == upstream_weight )
           || ( candidate->second.childrenList.empty() )
         ) );
 }
 
-
-
-
-
-
+/**
+ * Checks if a node is frozen
+ * @param node Node
+ * @return Frozen state
+ */
+bool sbp::algo::GraphCompressor::isFrozen( const GraphIterator_t &node ) const {
+    return !_frozen.empty() && _frozen.find( node->first ) != _frozen.end();
+}
@@ -14,6 +14,7 @@
 #define SUPERBUBBLE_PERFORMANCE_GRAPHCOMPRESSOR_H
 
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
 #include <string>
 
@@ -25,6 +26,7 @@ namespace sbp {
         class GraphCompressor {
           public:
             GraphCompressor( eadlib::WeightedGraph<std::string> &graph );
+            GraphCompressor( eadlib::WeightedGraph<std::string> &graph, const std::unordered_set<std::string> &frozen );
             ~GraphCompressor();
             void compress();
           private:
@@ -38,9 +40,11 @@ namespace sbp {
                                         const size_t &previous_weight ) const;
             bool validateCandidate( const GraphIterator_t &candidate,
                                     const size_t &upstream_weight );
+            bool isFrozen( const GraphIterator_t &node ) const;
 
             eadlib::WeightedGraph<std::string> & _graph;
             std::vector<std::string> _vector_of_kmers;
+            std::unordered_set<std::string> _frozen; //nodes left out of any merge
         };
     }
 }
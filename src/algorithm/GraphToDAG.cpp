@@ -1,9 +1,14 @@
 #include "GraphToDAG.h"
 
+#include <algorithm>
+
 /**
  * Constructor
+ * @param thread_count Number of SubGraphs converted concurrently
  */
-sbp::algo::GraphToDAG::GraphToDAG() {}
+sbp::algo::GraphToDAG::GraphToDAG( const size_t &thread_count ) :
+    _thread_count( std::max<size_t>( 1, thread_count ) )
+{}
 
 /**
  * Destructor
@@ -17,132 +22,266 @@ sbp::algo::GraphToDAG::~GraphToDAG() {}
  */
 std::unique_ptr<sbp::algo::GraphToDAG::DAG_List_t> sbp::algo::GraphToDAG::convertToDAG( const std::list<graph::SubGraph> &sg_list,
                                                                                         const std::string &dag_name_prefix ) {
+    return convertList( sg_list, dag_name_prefix );
+}
+
+/**
+ * Converts a set of SubGraph views into DAGs
+ * @param sg_list SubGraph view list
+ * @return list of DAGs in the same order as the SubGraph view list
+ */
+std::unique_ptr<sbp::algo::GraphToDAG::DAG_List_t> sbp::algo::GraphToDAG::convertToDAG( const std::list<graph::SubGraphView> &sg_list,
+                                                                                        const std::string &dag_name_prefix ) {
+    return convertList( sg_list, dag_name_prefix );
+}
+
+/**
+ * Converts a single SubGraph into a DAG (for SubGraphs streamed one at a time)
+ * @param sub_graph SubGraph to convert
+ * @param dag_name  Name of the DAG
+ * @return List holding the DAG package
+ */
+std::unique_ptr<sbp::algo::GraphToDAG::DAG_List_t> sbp::algo::GraphToDAG::convert( const graph::SubGraph &sub_graph,
+                                                                                   const std::string &dag_name ) {
     _dag_package_list = std::make_unique<std::list<sbp::algo::GraphToDAG::DAG_Package>>();
+    convertToDAG( sub_graph, *_dag_package_list->emplace( _dag_package_list->end(), DAG_Package( dag_name, 0 ) ) );
+    return std::move( _dag_package_list );
+}
+
+/**
+ * Converts a single SubGraph view into a DAG (for SubGraphs streamed one at a time)
+ * @param sub_graph SubGraph view to convert
+ * @param dag_name  Name of the DAG
+ * @return List holding the DAG package
+ */
+std::unique_ptr<sbp::algo::GraphToDAG::DAG_List_t> sbp::algo::GraphToDAG::convert( const graph::SubGraphView &sub_graph,
+                                                                                   const std::string &dag_name ) {
+    _dag_package_list = std::make_unique<std::list<sbp::algo::GraphToDAG::DAG_Package>>();
+    convertToDAG( sub_graph, *_dag_package_list->emplace( _dag_package_list->end(), DAG_Package( dag_name, 0 ) ) );
+    return std::move( _dag_package_list );
+}
+
+/**
+ * Converts a set of SubGraphs into DAGs concurrently (largest SubGraphs first)
+ * @param sg_list SubGraph list
+ * @return list of DAGs in the same order as the SubGraph list
+ */
+template<class SubGraph_t> std::unique_ptr<sbp::algo::GraphToDAG::DAG_List_t> sbp::algo::GraphToDAG::convertList( const std::list<SubGraph_t> &sg_list,
+                                                                                                                  const std::string &dag_name_prefix ) {
+    _dag_package_list = std::make_unique<std::list<sbp::algo::GraphToDAG::DAG_Package>>();
+    //Packages are all created upfront so that the workers only fill their own
+    std::vector<std::pair<const SubGraph_t *, DAG_Package *>> jobs;
+    jobs.reserve( sg_list.size() );
     size_t sg_count { 0 };
     for( auto it = sg_list.begin(); it != sg_list.end(); ++it ) {
-        convertToDAG( *it, std::string( dag_name_prefix + std::to_string( sg_count ) ) );
+        auto dag_name = std::string( dag_name_prefix + std::to_string( sg_count ) );
+        jobs.emplace_back( &( *it ), &( *_dag_package_list->emplace( _dag_package_list->end(), DAG_Package( dag_name, 0 ) ) ) );
         sg_count++;
     }
+    std::vector<size_t> order( jobs.size() );
+    for( size_t i = 0; i < order.size(); i++ ) {
+        order[ i ] = i;
+    }
+    std::stable_sort( order.begin(), order.end(), [&]( const size_t &a, const size_t &b ) {
+        return jobs[ a ].first->nodeCount() > jobs[ b ].first->nodeCount();
+    } );
+    std::atomic<size_t> next { 0 };
+    auto worker = [&]() {
+        for( auto i = next.fetch_add( 1 ); i < order.size(); i = next.fetch_add( 1 ) ) {
+            convertToDAG( *jobs[ order[ i ] ].first, *jobs[ order[ i ] ].second );
+        }
+    };
+    auto worker_count = std::min( _thread_count, jobs.size() );
+    if( worker_count <= 1 ) {
+        worker();
+    } else {
+        std::vector<std::thread> workers;
+        for( size_t w = 0; w < worker_count; w++ ) {
+            workers.emplace_back( worker );
+        }
+        for( auto &thread : workers ) {
+            thread.join();
+        }
+    }
     return std::move( _dag_package_list );
 }
 
 /**
  * Converts a SubGraph into a DAG
  * @param sub_graph SubGraph to convert
+ * @param dag_pack  Empty DAG package (named) to convert into
+ */
+template<class SubGraph_t> void sbp::algo::GraphToDAG::convertToDAG( const SubGraph_t &sub_graph,
+                                                                     DAG_Package &dag_pack ) const {
+    auto implicit = createImplicit( sub_graph, dag_pack._dag.getName() );
+    implicit->_dag.materialise( dag_pack._dag );
+    dag_pack._discovery_times = std::move( implicit->_discovery_times );
+    dag_pack._finish_times    = std::move( implicit->_finish_times );
+}
+
+/**
+ * Converts a single SubGraph into an implicit DAG
+ * @param sub_graph SubGraph to convert
+ * @param dag_name  Name of the DAG
+ * @return Implicit DAG package
  */
-void sbp::algo::GraphToDAG::convertToDAG( const graph::SubGraph &sub_graph,
-                                          const std::string &dag_name ) {
-    auto dag_pack = _dag_package_list->emplace( _dag_package_list->end(), DAG_Package( dag_name, sub_graph.nodeCount() ) );
-    auto dag = &dag_pack->_dag;
-    dag->addNodes( sub_graph );
+std::unique_ptr<sbp::algo::GraphToDAG::ImplicitDAG_Package> sbp::algo::GraphToDAG::convertImplicit( const graph::SubGraph &sub_graph,
+                                                                                                    const std::string &dag_name ) {
+    return createImplicit( sub_graph, dag_name );
+}
+
+/**
+ * Converts a single SubGraph view into an implicit DAG
+ * @param sub_graph SubGraph view to convert
+ * @param dag_name  Name of the DAG
+ * @return Implicit DAG package
+ */
+std::unique_ptr<sbp::algo::GraphToDAG::ImplicitDAG_Package> sbp::algo::GraphToDAG::convertImplicit( const graph::SubGraphView &sub_graph,
+                                                                                                    const std::string &dag_name ) {
+    return createImplicit( sub_graph, dag_name );
+}
+
+/**
+ * Creates the implicit DAG of a SubGraph
+ * @param sub_graph SubGraph to convert
+ * @param dag_name  Name of the DAG
+ * @return Implicit DAG package
+ */
+template<class SubGraph_t> std::unique_ptr<sbp::algo::GraphToDAG::ImplicitDAG_Package> sbp::algo::GraphToDAG::createImplicit( const SubGraph_t &sub_graph,
+                                                                                                                              const std::string &dag_name ) const {
+    //Compact copy of the SubGraph's adjacency
+    auto offsets = std::vector<size_t>( sub_graph.nodeCount() + 1, 0 );
+    auto targets = std::vector<size_t>();
+    for( size_t u = 0; u < sub_graph.nodeCount(); u++ ) {
+        const auto &node = sub_graph.at( u );
+        targets.insert( targets.end(), node.childrenList.begin(), node.childrenList.end() );
+        offsets[ u + 1 ] = targets.size();
+    }
+    auto dag_pack = std::make_unique<ImplicitDAG_Package>( dag_name, std::move( offsets ), std::move( targets ) );
+    classifyEdges( *dag_pack );
+    return dag_pack;
+}
+
+/**
+ * Types the edges of the SubGraph and links r/r' in an implicit DAG
+ * @param dag_pack Package holding the implicit DAG, discovery times and finish times
+ */
+void sbp::algo::GraphToDAG::classifyEdges( ImplicitDAG_Package &dag_pack ) const {
+    auto &dag     = dag_pack._dag;
+    auto sg_count = dag.getUniqueNodeCount();
     //create r->v in DAG
-    auto sg_source   = sub_graph.at( sub_graph.getSourceID() );
-    for( auto child : sg_source.childrenList ) { //create dag_source->v
-        if( child != sub_graph.getTerminalID() ) {
-            dag->createDirectedEdge( dag->getSourceID(), child );
+    for( auto e = dag.edgesBegin( dag.getSourceID() ); e < dag.edgesEnd( dag.getSourceID() ); e++ ) {
+        if( dag.getEdgeTarget( e ) != dag.getTerminalID() ) {
+            dag.linkToSource( dag.getEdgeTarget( e ) );
         }
     }
+    auto has_source = dag.edgesBegin( dag.getSourceID() ) != dag.edgesEnd( dag.getSourceID() );
 
     //create v'<-r' in DAG
-    auto sg_terminal = sub_graph.at( sub_graph.getTerminalID() );
-    for( auto parent : sg_terminal.parentsList ) { //create v<-dag_terminal
-        if( parent != sub_graph.getSourceID() ) {
-            auto dag_duplicate = dag->findLocalID( parent + dag->getUniqueNodeCount() - 2 );
-            if( dag_duplicate != dag->end() ) {
-                dag->createDirectedEdge( dag_duplicate->first, dag->getTerminalID() );
-            } else {
-                LOG_ERROR( "[sbp::algo::GraphToDAG::convertToDAG( <graph::SubGraph>, ", dag_name, ")] "
-                    "Problem finding the duplicate ID [", dag_duplicate->first ,"] of local node [", parent, "] in the DAG." );
+    bool   has_terminal { false };
+    size_t exit_node { 3 };
+    for( size_t u = 0; u < sg_count; u++ ) {
+        for( auto e = dag.edgesBegin( u ); e < dag.edgesEnd( u ); e++ ) {
+            if( dag.getEdgeTarget( e ) == dag.getTerminalID() ) {
+                if( u != dag.getSourceID() ) {
+                    dag.linkToTerminal( dag.getDuplicateID( u ) );
+                    if( !has_terminal ) {
+                        exit_node = u;
+                    }
+                }
+                has_terminal = true;
             }
         }
     }
 
-    //if no out-degree from r, choose random v as source/root (not really random but does the trick..)
-    auto root = sg_source.childrenList.empty() ? 3 : sub_graph.getSourceID();
-    auto sg_colours = std::vector<DFSColours>( sub_graph.size(), DFSColours::WHITE );
-    visitUsingDFS( sub_graph, root, sg_colours, 0, *dag_pack );
+    //if no out-degree from r, start from a node with an edge out of the SCC: it can't be inside a superbubble
+    //(a superbubble around the root is split between the two copies of the DAG and missed)
+    auto root = has_source ? dag.getSourceID() : exit_node;
+    auto sg_colours = std::vector<DFSColours>( sg_count, DFSColours::WHITE );
+    visitUsingDFS( root, sg_colours, 0, dag_pack );
 
     //adjust source and terminal vertices
-    if( sub_graph.getOutDegree( sub_graph.getSourceID() ) == 0 ) { //G does not contain r
-        for( auto it = dag->begin(); it != dag->end(); ++it ) {
-            if( it->first != dag->getSourceID() && it->first != dag->getTerminalID() ) {
-                if( dag->getInDegree( it->first ) == 0 ) {
-                    //for every u ∈ V (G ) such that u has no incoming edge in G' create an edge (r, u)
-                    dag->createDirectedEdge( dag->getSourceID(), it->first );
-                }
+    if( !has_source ) { //G does not contain r
+        for( size_t v = 2; v < dag.nodeCount(); v++ ) {
+            if( dag.getInDegree( v ) == 0 ) {
+                //for every u ∈ V (G ) such that u has no incoming edge in G' create an edge (r, u)
+                dag.linkToSource( v );
             }
         }
     }
-    if( sub_graph.getInDegree( sub_graph.getTerminalID() ) == 0 ) { //G does not contain r'
-        for( auto it = dag->begin(); it != dag->end(); ++it ) {
-            if( it->first != dag->getSourceID() && it->first != dag->getTerminalID() ) {
-                if( dag->getOutDegree( it->first ) == 0 ) {
-                    //for every u ∈ V (G ) such that u has no outgoing edge in G' create an edge (u, r')
-                    dag->createDirectedEdge( it->first, dag->getTerminalID() );
-                }
+    if( !has_terminal ) { //G does not contain r'
+        for( size_t v = 2; v < dag.nodeCount(); v++ ) {
+            if( dag.getOutDegree( v ) == 0 ) {
+                //for every u ∈ V (G ) such that u has no outgoing edge in G' create an edge (u, r')
+                dag.linkToTerminal( v );
             }
         }
     }
 }
 
 /**
- * DFS visit of nodes in SubGraph to create edges
- * @param sub_graph SubGraph to visit in
- * @param u         Node to visit
+ * DFS visit of nodes in SubGraph to type its edges (iterative)
+ * The times are given as the recursive visit did: a node's discovery time is its parent's + 1
+ * and its finish time its discovery time + 1.
+ * @param root      Node to start the visit from
  * @param colour    Node colours for the SubGraph
  * @param time      Reach time
- * @param dag_pack  Package holding the DAG, discovery times and finish times
+ * @param dag_pack  Package holding the implicit DAG, discovery times and finish times
  */
-void sbp::algo::GraphToDAG::visitUsingDFS( const sbp::graph::SubGraph &sub_graph,
-                                           const size_t &u,
+void sbp::algo::GraphToDAG::visitUsingDFS( const size_t &root,
                                            std::vector<sbp::algo::GraphToDAG::DFSColours> &colour,
                                            size_t time,
-                                           DAG_Package &dag_pack ) {
+                                           ImplicitDAG_Package &dag_pack ) const {
+    auto &dag = dag_pack._dag;
 
     /**
      * [Lambda] Check that u/v are source or terminal nodes
      */
     auto notSourceOrTerminal = [&]( const size_t &u, const size_t &v ) {
-        return ( u != sub_graph.getSourceID() && u != sub_graph.getTerminalID()
-                 && v != sub_graph.getSourceID() && v != sub_graph.getTerminalID() );
+        return ( u != dag.getSourceID() && u != dag.getTerminalID()
+                 && v != dag.getSourceID() && v != dag.getTerminalID() );
     };
 
-    auto dag       = &dag_pack._dag;
-    auto discovery = &dag_pack._discovery_times;
-    auto finish    = &dag_pack._finish_times;
-
-    colour.at( u ) = DFSColours::GREY;
-    discovery->at( u ) = ++time;
-    if( !sub_graph.at( u ).childrenList.empty() ) {
-        auto node = sub_graph.at( u );
-        for( auto v : node.childrenList ) {
+    struct Frame {
+        size_t _node;
+        size_t _edge; //next edge to look at
+        size_t _time;
+    };
+    auto call_stack = std::vector<Frame>();
+    colour.at( root ) = DFSColours::GREY;
+    dag_pack._discovery_times.at( root ) = ++time;
+    call_stack.emplace_back( Frame( { root, dag.edgesBegin( root ), time } ) );
+    while( !call_stack.empty() ) {
+        auto u = call_stack.back()._node;
+        if( call_stack.back()._edge < dag.edgesEnd( u ) ) {
+            auto e = call_stack.back()._edge++;
+            auto v = dag.getEdgeTarget( e );
             switch( colour.at( v ) ) {
-                case DFSColours::WHITE: //u->v is a tree edge
+                case DFSColours::WHITE: { //u->v is a tree edge
                     if( notSourceOrTerminal( u, v ) ) {
-                        auto u_duplicate = u + dag->getUniqueNodeCount() - 2;
-                        auto v_duplicate = v + dag->getUniqueNodeCount() - 2;
-                        dag->createDirectedEdge( u, v );
-                        dag->createDirectedEdge( u_duplicate, v_duplicate );
+                        dag.setEdgeType( e, graph::ImplicitDAG::EdgeType::TREE );
                     }
-                    visitUsingDFS( sub_graph, v, colour, time, dag_pack );
+                    auto v_time = call_stack.back()._time + 1;
+                    colour.at( v ) = DFSColours::GREY;
+                    dag_pack._discovery_times.at( v ) = v_time;
+                    call_stack.emplace_back( Frame( { v, dag.edgesBegin( v ), v_time } ) );
                     break;
+                }
                 case DFSColours::GREY: //u->v is a back edge
                     if( notSourceOrTerminal( u, v ) ) {
-                        auto v_duplicate = dag->findLocalID( v + dag->getUniqueNodeCount() - 2 )->first;
-                        dag->createDirectedEdge( u, v_duplicate );
+                        dag.setEdgeType( e, graph::ImplicitDAG::EdgeType::BACK );
                     }
                     break;
                 case DFSColours::BLACK: //u->v is either a forward or cross edge
                     if( notSourceOrTerminal( u, v ) ) {
-                        auto u_duplicate = dag->findLocalID( u + dag->getUniqueNodeCount() - 2 )->first;
-                        auto v_duplicate = dag->findLocalID( v + dag->getUniqueNodeCount() - 2 )->first;
-                        dag->createDirectedEdge( u, v );
-                        dag->createDirectedEdge( u_duplicate, v_duplicate );
+                        dag.setEdgeType( e, graph::ImplicitDAG::EdgeType::TREE );
                     }
                     break;
             }
+        } else {
+            colour.at( u ) = DFSColours::BLACK;
+            dag_pack._finish_times.at( u ) = call_stack.back()._time + 1;
+            call_stack.pop_back();
         }
     }
-    colour.at( u ) = DFSColours::BLACK;
-    finish->at( u ) = ++time;
-}
\ No newline at end of file
+}
@@ -5,15 +5,25 @@
     Implementation of the 'GraphToDAG(G)' algorithm found in the Quasi-Linear SuperBubble algorithm paper
     See the README.md
 
-    @dependencies   sbp::graph::SubGraph, sbp::graph::DAG
+    Converts either SubGraphs or SubGraphViews (same local ID layout).
+    Lists of SubGraphs are converted concurrently (largest SubGraphs first).
+    The DFS types the edges of an ImplicitDAG (no duplicated nodes nor edge copies stored);
+    the explicit DAGs are materialised from it.
+
+    @dependencies   sbp::graph::SubGraph, sbp::graph::SubGraphView, sbp::graph::DAG, sbp::graph::ImplicitDAG
 **/
 #ifndef SUPERBUBBLE_PERFORMANCE_GRAPHTODAG_H
 #define SUPERBUBBLE_PERFORMANCE_GRAPHTODAG_H
 
+#include <atomic>
 #include <list>
+#include <thread>
+#include <vector>
 #include <eadlib/logger/Logger.h>
 #include "../graph/SubGraph.h"
+#include "../graph/SubGraphView.h"
 #include "../graph/DAG.h"
+#include "../graph/ImplicitDAG.h"
 
 namespace sbp {
     namespace algo {
@@ -29,12 +39,32 @@ namespace sbp {
                 std::vector<size_t> _discovery_times;
                 std::vector<size_t> _finish_times;
             };
+            struct ImplicitDAG_Package {
+                ImplicitDAG_Package( const std::string &dag_name, std::vector<size_t> &&offsets, std::vector<size_t> &&targets ) :
+                    _dag( graph::ImplicitDAG( dag_name, std::move( offsets ), std::move( targets ) ) ),
+                    _discovery_times( _dag.getUniqueNodeCount() ),
+                    _finish_times( _dag.getUniqueNodeCount() )
+                {};
+                graph::ImplicitDAG  _dag;
+                std::vector<size_t> _discovery_times;
+                std::vector<size_t> _finish_times;
+            };
             typedef std::list<DAG_Package> DAG_List_t;
-            GraphToDAG();
+            GraphToDAG( const size_t &thread_count = std::thread::hardware_concurrency() );
             ~GraphToDAG();
             //Converters
             std::unique_ptr<DAG_List_t> convertToDAG( const std::list<graph::SubGraph> &sg_list,
                                                       const std::string &dag_name_prefix );
+            std::unique_ptr<DAG_List_t> convertToDAG( const std::list<graph::SubGraphView> &sg_list,
+                                                      const std::string &dag_name_prefix );
+            std::unique_ptr<DAG_List_t> convert( const graph::SubGraph &sub_graph,
+                                                 const std::string &dag_name );
+            std::unique_ptr<DAG_List_t> convert( const graph::SubGraphView &sub_graph,
+                                                 const std::string &dag_name );
+            std::unique_ptr<ImplicitDAG_Package> convertImplicit( const graph::SubGraph &sub_graph,
+                                                                  const std::string &dag_name );
+            std::unique_ptr<ImplicitDAG_Package> convertImplicit( const graph::SubGraphView &sub_graph,
+                                                                  const std::string &dag_name );
           private:
             enum class DFSColours {
                 WHITE,
@@ -42,14 +72,19 @@ namespace sbp {
                 BLACK
             };
             std::unique_ptr<DAG_List_t> _dag_package_list;
+            size_t                      _thread_count;
 
-            void convertToDAG( const graph::SubGraph &sub_graph,
-                               const std::string &dag_name );
-            void visitUsingDFS( const graph::SubGraph &sub_graph,
-                                const size_t &u,
+            template<class SubGraph_t> std::unique_ptr<DAG_List_t> convertList( const std::list<SubGraph_t> &sg_list,
+                                                                                const std::string &dag_name_prefix );
+            template<class SubGraph_t> void convertToDAG( const SubGraph_t &sub_graph,
+                                                          DAG_Package &dag_pack ) const;
+            template<class SubGraph_t> std::unique_ptr<ImplicitDAG_Package> createImplicit( const SubGraph_t &sub_graph,
+                                                                                            const std::string &dag_name ) const;
+            void classifyEdges( ImplicitDAG_Package &dag_pack ) const;
+            void visitUsingDFS( const size_t &root,
                                 std::vector<DFSColours> &colour,
                                 size_t time,
-                                DAG_Package &dag_pack );
+                                ImplicitDAG_Package &dag_pack ) const;
         };
     }
 }
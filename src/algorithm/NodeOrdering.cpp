@@ -0,0 +1,113 @@
+#include "NodeOrdering.h"
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+
+/**
+ * Constructor
+ * @param graph Kmer graph to renumber (dense node IDs)
+ */
+sbp::algo::NodeOrdering::NodeOrdering( eadlib::WeightedGraph<std::string> &graph ) :
+    _graph( graph )
+{}
+
+/**
+ * Destructor
+ */
+sbp::algo::NodeOrdering::~NodeOrdering() {}
+
+/**
+ * Renumbers the graph's node IDs in reverse Cuthill-McKee order
+ * @return Success
+ */
+bool sbp::algo::NodeOrdering::reorder() {
+    if( !_graph.hasDenseNodeIDs() ) {
+        LOG_ERROR( "[sbp::algo::NodeOrdering::reorder()] Graph node IDs are not dense." );
+        return false;
+    }
+    std::vector<std::vector<size_t>> neighbours;
+    buildNeighbours( neighbours );
+    auto by_degree = [&]( const size_t &a, const size_t &b ) {
+        return neighbours[ a ].size() < neighbours[ b ].size()
+               || ( neighbours[ a ].size() == neighbours[ b ].size() && a < b );
+    };
+    //Seeds: lowest degree node of each not yet visited component
+    std::vector<size_t> seeds( neighbours.size() );
+    std::iota( seeds.begin(), seeds.end(), 0 );
+    std::sort( seeds.begin(), seeds.end(), by_degree );
+    for( auto &list : neighbours ) {
+        std::sort( list.begin(), list.end(), by_degree );
+    }
+    //Cuthill-McKee breadth-first traversal
+    std::vector<size_t> order;
+    std::vector<bool>   visited( neighbours.size(), false );
+    std::queue<size_t>  queue;
+    order.reserve( neighbours.size() );
+    for( const auto &seed : seeds ) {
+        if( visited[ seed ] ) {
+            continue;
+        }
+        visited[ seed ] = true;
+        queue.push( seed );
+        while( !queue.empty() ) {
+            size_t current = queue.front();
+            queue.pop();
+            order.emplace_back( current );
+            for( const auto &next : neighbours[ current ] ) {
+                if( !visited[ next ] ) {
+                    visited[ next ] = true;
+                    queue.push( next );
+                }
+            }
+        }
+    }
+    //Reversed order as the new IDs
+    std::vector<size_t> new_ids( order.size() );
+    for( size_t i = 0; i < order.size(); i++ ) {
+        new_ids[ order[ i ] ] = order.size() - 1 - i;
+    }
+    return _graph.renumberNodes( new_ids );
+}
+
+/**
+ * Measures how far apart connected nodes are in the ID space
+ * @param graph Kmer graph
+ * @return Edge span statistics
+ */
+sbp::algo::NodeOrdering::EdgeSpan sbp::algo::NodeOrdering::edgeSpan( const eadlib::WeightedGraph<std::string> &graph ) {
+    auto   span  = EdgeSpan { 0, 0 };
+    double total { 0 };
+    size_t count { 0 };
+    for( const auto &node : graph ) {
+        for( const auto &child : node.second.childrenList ) {
+            size_t to = graph.getNodeID( child );
+            size_t distance = to > node.second.id ? to - node.second.id : node.second.id - to;
+            span._max = std::max( span._max, distance );
+            total += distance;
+            count++;
+        }
+    }
+    span._mean = count > 0 ? total / count : 0;
+    return span;
+}
+
+/**
+ * Builds the undirected adjacency lists of the graph by node ID
+ * @param neighbours Container for the neighbour IDs of each node ID
+ */
+void sbp::algo::NodeOrdering::buildNeighbours( std::vector<std::vector<size_t>> &neighbours ) const {
+    neighbours.assign( _graph.nodeCount(), std::vector<size_t>() );
+    for( const auto &node : _graph ) {
+        auto &list = neighbours[ node.second.id ];
+        list.reserve( node.second.childrenList.size() + node.second.parentsList.size() );
+        for( const auto &child : node.second.childrenList ) {
+            list.emplace_back( _graph.getNodeID( child ) );
+        }
+        for( const auto &parent : node.second.parentsList ) {
+            list.emplace_back( _graph.getNodeID( parent ) );
+        }
+        std::sort( list.begin(), list.end() );
+        list.erase( std::unique( list.begin(), list.end() ), list.end() );
+    }
+}
@@ -0,0 +1,44 @@
+/**
+    @class          sbp::algo::NodeOrdering
+    @brief          Locality-improving node renumbering for a kmer graph
+
+                    Node IDs are reassigned in reverse Cuthill-McKee order
+                    (breadth-first over the undirected view of the graph,
+                    lowest degree nodes first) so neighbouring nodes get
+                    close IDs and every ID-indexed array built from the
+                    graph further down the pipeline is walked mostly
+                    sequentially. Unitig chains end up with consecutive IDs.
+
+    @dependencies   eadlib::WeightedGraph<T>, eadlib::logger::Logger
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2017
+    @license        GNUv2 Public License
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_NODEORDERING_H
+#define SUPERBUBBLE_PERFORMANCE_NODEORDERING_H
+
+#include <string>
+#include <vector>
+#include <eadlib/logger/Logger.h>
+#include <eadlib/datastructure/WeightedGraph.h>
+
+namespace sbp {
+    namespace algo {
+        class NodeOrdering {
+          public:
+            struct EdgeSpan {
+                double _mean; //average |from ID - to ID| over all edges
+                size_t _max;  //largest |from ID - to ID| (i.e.: bandwidth)
+            };
+            NodeOrdering( eadlib::WeightedGraph<std::string> &graph );
+            ~NodeOrdering();
+            bool reorder();
+            static EdgeSpan edgeSpan( const eadlib::WeightedGraph<std::string> &graph );
+          private:
+            void buildNeighbours( std::vector<std::vector<size_t>> &neighbours ) const;
+            eadlib::WeightedGraph<std::string> & _graph;
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_NODEORDERING_H
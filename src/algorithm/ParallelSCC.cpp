@@ -0,0 +1,360 @@
+#include "ParallelSCC.h"
+
+#include <algorithm>
+
+constexpr size_t sbp::algo::ParallelSCC::MIN_PARALLEL_NODES;
+constexpr size_t sbp::algo::ParallelSCC::DONE;
+
+//--------------------------------------------------------------------------------------------------------------------------------------------
+// ParallelSCC class public method implementations
+//--------------------------------------------------------------------------------------------------------------------------------------------
+/**
+ * Constructor
+ * @param graph        deBruijn MultiGraph
+ * @param thread_count Number of worker threads to use
+ */
+sbp::algo::ParallelSCC::ParallelSCC( const eadlib::WeightedGraph<size_t> &graph, const size_t &thread_count ) :
+    _graph( graph ),
+    _thread_count( std::max<size_t>( 1, thread_count ) ),
+    _id_bound( 0 ),
+    _next_colour( 1 )
+{}
+
+/**
+ * Destructor
+ */
+sbp::algo::ParallelSCC::~ParallelSCC() {}
+
+/**
+ * Finds Strongly Connected Components in the Graph
+ * @return List of strongly connected components with the first one being a concatenated list of singleton SCCs
+ *         (empty if there are none)
+ */
+std::unique_ptr<std::list<std::list<size_t>>> sbp::algo::ParallelSCC::findSCCs() {
+    auto scc_list = std::make_unique<std::list<std::list<size_t>>>();
+    auto sccs     = Tarjan::SCCArray();
+    if( !findSCCs( sccs ) ) {
+        return scc_list;
+    }
+    for( size_t i = 0; i < sccs.size(); i++ ) {
+        scc_list->emplace_back( sccs._members.begin() + sccs._offsets.at( i ),
+                                sccs._members.begin() + sccs._offsets.at( i + 1 ) );
+    }
+    return scc_list;
+}
+
+/**
+ * Finds Strongly Connected Components in the Graph
+ * @param sccs Flat SCC list to fill (SCC 0 is the concatenated list of singleton SCCs, possibly empty)
+ * @return Success
+ */
+bool sbp::algo::ParallelSCC::findSCCs( Tarjan::SCCArray &sccs ) {
+    sccs._offsets.assign( 1, 0 );
+    sccs._members.clear();
+    auto result = Result();
+    if( !search( result, nullptr ) ) {
+        return false;
+    }
+    //Canonical ordering
+    std::sort( result._singletons.begin(), result._singletons.end() );
+    for( auto &scc : result._cyclic ) {
+        std::sort( scc.begin(), scc.end() );
+    }
+    std::sort( result._cyclic.begin(), result._cyclic.end(),
+               []( const std::vector<size_t> &a, const std::vector<size_t> &b ) { return a.front() < b.front(); } );
+    sccs._members = std::move( result._singletons );
+    sccs._offsets.emplace_back( sccs._members.size() );
+    for( const auto &scc : result._cyclic ) {
+        sccs._members.insert( sccs._members.end(), scc.begin(), scc.end() );
+        sccs._offsets.emplace_back( sccs._members.size() );
+    }
+    return true;
+}
+
+/**
+ * Finds Strongly Connected Components in the Graph and passes each one on as soon as it is found
+ * (non-singleton SCCs first, then the concatenated list of singleton SCCs if there are any)
+ * The callback is called from the worker threads but never concurrently.
+ * @param callback Function called with each SCC
+ * @return Success
+ */
+bool sbp::algo::ParallelSCC::findSCCs( const Tarjan::SCCCallback_t &callback ) {
+    auto result = Result();
+    if( !search( result, &callback ) ) {
+        return false;
+    }
+    if( !result._singletons.empty() ) {
+        std::sort( result._singletons.begin(), result._singletons.end() );
+        callback( std::list<size_t>( result._singletons.begin(), result._singletons.end() ), true );
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------------------------
+// ParallelSCC class private method implementations
+//--------------------------------------------------------------------------------------------------------------------------------------------
+/**
+ * Searches the graph for its SCCs (trimming then forward-backward decomposition)
+ * @param result   Container for the singletons and, unless streamed, the non-singleton SCCs
+ * @param callback Function to pass each non-singleton SCC on to as soon as it's found (optional)
+ * @return Success
+ */
+bool sbp::algo::ParallelSCC::search( Result &result, const Tarjan::SCCCallback_t *callback ) {
+    //Error control
+    if( _graph.isEmpty() ) {
+        LOG_ERROR( "[sbp::algo::ParallelSCC::search( <Result>, <callback> )] Graph is empty." );
+        return false;
+    }
+    buildCSR();
+    //Peeling off the trivial singletons
+    trim( result._singletons );
+    LOG_DEBUG( "[sbp::algo::ParallelSCC::search( <Result>, <callback> )] ", result._singletons.size(), "/", _graph.nodeCount(), " nodes trimmed." );
+    //Forward-backward decomposition of the rest
+    std::vector<size_t> remaining;
+    for( size_t v = 0; v < _id_bound; v++ ) {
+        if( _colour[ v ].load( std::memory_order_relaxed ) != DONE ) {
+            remaining.emplace_back( v );
+        }
+    }
+    if( !remaining.empty() ) {
+        decompose( std::move( remaining ), result, callback );
+    }
+    return true;
+}
+
+/**
+ * Builds the forward and reverse CSR adjacency of the graph and resets the node colours
+ * (IDs in [0, max ID] that are not in the graph are marked as done straight away)
+ */
+void sbp::algo::ParallelSCC::buildCSR() {
+    typedef eadlib::WeightedGraph<size_t>::NodeAdjacency Adjacency_t;
+    _id_bound = 0;
+    for( const auto &node : _graph ) {
+        _id_bound = std::max( _id_bound, node.first + 1 );
+    }
+    std::vector<const Adjacency_t *> nodes( _id_bound, nullptr );
+    for( const auto &node : _graph ) {
+        nodes[ node.first ] = &node.second;
+    }
+    _out_offsets.assign( _id_bound + 1, 0 );
+    _in_offsets.assign( _id_bound + 1, 0 );
+    for( size_t v = 0; v < _id_bound; v++ ) {
+        _out_offsets[ v + 1 ] = _out_offsets[ v ] + ( nodes[ v ] ? nodes[ v ]->childrenList.size() : 0 );
+        _in_offsets[ v + 1 ]  = _in_offsets[ v ] + ( nodes[ v ] ? nodes[ v ]->parentsList.size() : 0 );
+    }
+    _out_targets.resize( _out_offsets.back() );
+    _in_targets.resize( _in_offsets.back() );
+    _colour = std::make_unique<std::atomic<size_t>[]>( _id_bound );
+    runChunks( _id_bound, [&]( const size_t &, const size_t &begin, const size_t &end ) {
+        for( size_t v = begin; v < end; v++ ) {
+            _colour[ v ].store( nodes[ v ] ? 0 : DONE, std::memory_order_relaxed );
+            if( nodes[ v ] ) {
+                std::copy( nodes[ v ]->childrenList.begin(), nodes[ v ]->childrenList.end(), _out_targets.begin() + _out_offsets[ v ] );
+                std::copy( nodes[ v ]->parentsList.begin(), nodes[ v ]->parentsList.end(), _in_targets.begin() + _in_offsets[ v ] );
+            }
+        }
+    } );
+}
+
+/**
+ * Peels off the nodes with no in-coming or no out-going edge from the remaining nodes in parallel rounds
+ * (every node peeled off is a singleton SCC and is marked as done)
+ * @param singletons Container for the singleton SCCs
+ */
+void sbp::algo::ParallelSCC::trim( std::vector<size_t> &singletons ) {
+    auto in_degree  = std::make_unique<std::atomic<size_t>[]>( _id_bound );
+    auto out_degree = std::make_unique<std::atomic<size_t>[]>( _id_bound );
+    std::vector<std::vector<size_t>> next( _thread_count );
+
+    /**
+     * [Lambda] Claims a node for removal (only one thread gets it)
+     */
+    auto claim = [&]( const size_t &v ) {
+        size_t expected { 0 };
+        return _colour[ v ].compare_exchange_strong( expected, DONE );
+    };
+
+    runChunks( _id_bound, [&]( const size_t &, const size_t &begin, const size_t &end ) {
+        for( size_t v = begin; v < end; v++ ) {
+            in_degree[ v ].store( _in_offsets[ v + 1 ] - _in_offsets[ v ], std::memory_order_relaxed );
+            out_degree[ v ].store( _out_offsets[ v + 1 ] - _out_offsets[ v ], std::memory_order_relaxed );
+        }
+    } );
+    runChunks( _id_bound, [&]( const size_t &w, const size_t &begin, const size_t &end ) {
+        for( size_t v = begin; v < end; v++ ) {
+            if( ( in_degree[ v ].load() == 0 || out_degree[ v ].load() == 0 ) && claim( v ) ) {
+                next[ w ].emplace_back( v );
+            }
+        }
+    } );
+    std::vector<size_t> frontier;
+    while( true ) {
+        frontier.clear();
+        for( auto &chunk : next ) {
+            frontier.insert( frontier.end(), chunk.begin(), chunk.end() );
+            chunk.clear();
+        }
+        if( frontier.empty() ) {
+            break;
+        }
+        singletons.insert( singletons.end(), frontier.begin(), frontier.end() );
+        runChunks( frontier.size(), [&]( const size_t &w, const size_t &begin, const size_t &end ) {
+            for( size_t i = begin; i < end; i++ ) {
+                auto v = frontier[ i ];
+                for( size_t e = _out_offsets[ v ]; e < _out_offsets[ v + 1 ]; e++ ) {
+                    auto child = _out_targets[ e ];
+                    if( in_degree[ child ].fetch_sub( 1 ) == 1 && claim( child ) ) {
+                        next[ w ].emplace_back( child );
+                    }
+                }
+                for( size_t e = _in_offsets[ v ]; e < _in_offsets[ v + 1 ]; e++ ) {
+                    auto parent = _in_targets[ e ];
+                    if( out_degree[ parent ].fetch_sub( 1 ) == 1 && claim( parent ) ) {
+                        next[ w ].emplace_back( parent );
+                    }
+                }
+            }
+        } );
+    }
+}
+
+/**
+ * Decomposes a set of nodes into SCCs with a pool of worker threads sharing a task queue
+ * @param nodes    Nodes (all with the colour 0)
+ * @param result   Container for the SCCs found
+ * @param callback Function to pass each non-singleton SCC on to instead of the result (optional)
+ */
+void sbp::algo::ParallelSCC::decompose( std::vector<size_t> &&nodes, Result &result, const Tarjan::SCCCallback_t *callback ) {
+    std::mutex              mutex;
+    std::mutex              callback_mutex;
+    std::condition_variable task_available;
+    std::deque<Task>        queue;
+    size_t                  active { 0 };
+    queue.emplace_back( Task( 0, std::move( nodes ) ) );
+    std::vector<Result> results( _thread_count );
+    std::vector<std::thread> workers;
+    for( size_t w = 0; w < _thread_count; w++ ) {
+        workers.emplace_back( [&, w]() {
+            std::vector<Task> new_tasks;
+            auto emit = [&]( std::vector<size_t> &&scc ) {
+                if( callback ) {
+                    std::sort( scc.begin(), scc.end() );
+                    auto members = std::list<size_t>( scc.begin(), scc.end() );
+                    scc = std::vector<size_t>();
+                    std::lock_guard<std::mutex> guard( callback_mutex );
+                    ( *callback )( members, false );
+                } else {
+                    results[ w ]._cyclic.emplace_back( std::move( scc ) );
+                }
+            };
+            while( true ) {
+                std::unique_lock<std::mutex> lock( mutex );
+                task_available.wait( lock, [&]() { return !queue.empty() || active == 0; } );
+                if( queue.empty() ) { //no task left and none being processed
+                    task_available.notify_all();
+                    return;
+                }
+                auto task = std::move( queue.front() );
+                queue.pop_front();
+                active++;
+                lock.unlock();
+                process( task, new_tasks, results[ w ], emit );
+                lock.lock();
+                active--;
+                for( auto &new_task : new_tasks ) {
+                    queue.emplace_back( std::move( new_task ) );
+                }
+                new_tasks.clear();
+                task_available.notify_all();
+            }
+        } );
+    }
+    for( auto &worker : workers ) {
+        worker.join();
+    }
+    for( auto &local : results ) {
+        result._singletons.insert( result._singletons.end(), local._singletons.begin(), local._singletons.end() );
+        for( auto &scc : local._cyclic ) {
+            result._cyclic.emplace_back( std::move( scc ) );
+        }
+    }
+}
+
+/**
+ * Finds the SCC of a pivot node in a task's node set and splits the rest into new tasks
+ * @param task      Task (node set sharing a unique colour)
+ * @param new_tasks Container for the new tasks
+ * @param result    Container for the singleton found
+ * @param emit      Function the non-singleton SCC found is given to
+ */
+void sbp::algo::ParallelSCC::process( Task &task, std::vector<Task> &new_tasks, Result &result, const Emit_t &emit ) {
+    auto colour = task._colour;
+    auto pivot  = task._nodes.front();
+    if( task._nodes.size() == 1 ) {
+        _colour[ pivot ].store( DONE, std::memory_order_relaxed );
+        result._singletons.emplace_back( pivot );
+        return;
+    }
+    auto fw_colour = _next_colour.fetch_add( 2 );
+    auto bw_colour = fw_colour + 1;
+    //Forward reach of the pivot in the set
+    std::vector<size_t> reached { pivot };
+    _colour[ pivot ].store( fw_colour, std::memory_order_relaxed );
+    for( size_t i = 0; i < reached.size(); i++ ) {
+        auto v = reached[ i ];
+        for( size_t e = _out_offsets[ v ]; e < _out_offsets[ v + 1 ]; e++ ) {
+            auto w = _out_targets[ e ];
+            if( _colour[ w ].load( std::memory_order_relaxed ) == colour ) {
+                _colour[ w ].store( fw_colour, std::memory_order_relaxed );
+                reached.emplace_back( w );
+            }
+        }
+    }
+    //Backward reach of the pivot in the set (forward reached nodes met are the SCC)
+    std::vector<size_t> scc { pivot };
+    reached.assign( 1, pivot );
+    _colour[ pivot ].store( DONE, std::memory_order_relaxed );
+    for( size_t i = 0; i < reached.size(); i++ ) {
+        auto v = reached[ i ];
+        for( size_t e = _in_offsets[ v ]; e < _in_offsets[ v + 1 ]; e++ ) {
+            auto u = _in_targets[ e ];
+            auto c = _colour[ u ].load( std::memory_order_relaxed );
+            if( c == fw_colour ) {
+                _colour[ u ].store( DONE, std::memory_order_relaxed );
+                scc.emplace_back( u );
+                reached.emplace_back( u );
+            } else if( c == colour ) {
+                _colour[ u ].store( bw_colour, std::memory_order_relaxed );
+                reached.emplace_back( u );
+            }
+        }
+    }
+    if( scc.size() == 1 ) {
+        result._singletons.emplace_back( pivot );
+    } else {
+        emit( std::move( scc ) );
+    }
+    //Splitting what's left of the set
+    std::vector<size_t> fw_nodes, bw_nodes, other_nodes;
+    for( auto v : task._nodes ) {
+        auto c = _colour[ v ].load( std::memory_order_relaxed );
+        if( c == fw_colour ) {
+            fw_nodes.emplace_back( v );
+        } else if( c == bw_colour ) {
+            bw_nodes.emplace_back( v );
+        } else if( c == colour ) {
+            other_nodes.emplace_back( v );
+        }
+    }
+    task._nodes.clear();
+    task._nodes.shrink_to_fit();
+    if( !fw_nodes.empty() ) {
+        new_tasks.emplace_back( Task( fw_colour, std::move( fw_nodes ) ) );
+    }
+    if( !bw_nodes.empty() ) {
+        new_tasks.emplace_back( Task( bw_colour, std::move( bw_nodes ) ) );
+    }
+    if( !other_nodes.empty() ) {
+        new_tasks.emplace_back( Task( colour, std::move( other_nodes ) ) );
+    }
+}
@@ -0,0 +1,111 @@
+/**
+    @class          sbp::algo::ParallelSCC
+    @brief          Multi-threaded algorithm to find SCCs in a graph
+
+                    Forward-backward decomposition with trimming:
+                    1) nodes with no in-coming or no out-going edge among the remaining
+                       nodes are peeled off as singleton SCCs in parallel rounds,
+                    2) the rest is split into tasks processed by a pool of worker threads;
+                       for a task's node set S and a pivot p the SCC of p is FW(p) ∩ BW(p)
+                       and the 3 sets FW(p) \ SCC, BW(p) \ SCC and S \ ( FW(p) ∪ BW(p) )
+                       become new independent tasks.
+
+                    Gives the same partition as sbp::algo::Tarjan with the same convention
+                    (singletons concatenated as the first SCC). The output is in canonical
+                    order (ascending node IDs inside each SCC, SCCs by their smallest node)
+                    so it does not depend on the thread scheduling.
+                    When streamed to a callback each non-singleton SCC is passed on by the
+                    worker that found it as soon as it is found (one at a time, in the order
+                    they are found) and the concatenated singletons last, as sbp::algo::Tarjan
+                    does, so that no SCC is held once passed on.
+                    Node IDs are expected to be dense (i.e. [0, node count)).
+
+    @dependencies   eadlib::WeightedGraph<T>, eadlib::logger::Logger, sbp::algo::Tarjan
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2017
+    @license        GNUv2 Public License
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_PARALLELSCC_H
+#define SUPERBUBBLE_PERFORMANCE_PARALLELSCC_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <eadlib/logger/Logger.h>
+#include <eadlib/datastructure/WeightedGraph.h>
+#include "Tarjan.h"
+
+namespace sbp {
+    namespace algo {
+        class ParallelSCC {
+          public:
+            //Graphs smaller than this are better off with the serial Tarjan
+            static constexpr size_t MIN_PARALLEL_NODES = 100000;
+            ParallelSCC( const eadlib::WeightedGraph<size_t> &graph,
+                         const size_t &thread_count = std::thread::hardware_concurrency() );
+            ~ParallelSCC();
+            std::unique_ptr<std::list<std::list<size_t>>> findSCCs();
+            bool findSCCs( Tarjan::SCCArray &sccs );
+            bool findSCCs( const Tarjan::SCCCallback_t &callback );
+          private:
+            struct Task {
+                Task( const size_t &colour, std::vector<size_t> &&nodes ) :
+                    _colour( colour ),
+                    _nodes( std::move( nodes ) )
+                {}
+                size_t              _colour;
+                std::vector<size_t> _nodes;
+            };
+            struct Result {
+                std::vector<size_t>              _singletons;
+                std::vector<std::vector<size_t>> _cyclic;
+            };
+            typedef std::function<void( std::vector<size_t> &&scc )> Emit_t;
+            bool search( Result &result, const Tarjan::SCCCallback_t *callback );
+            void buildCSR();
+            void trim( std::vector<size_t> &singletons );
+            void decompose( std::vector<size_t> &&nodes, Result &result, const Tarjan::SCCCallback_t *callback );
+            void process( Task &task, std::vector<Task> &new_tasks, Result &result, const Emit_t &emit );
+            template<class Function> void runChunks( const size_t &size, const Function &function ) const;
+            const eadlib::WeightedGraph<size_t> &_graph;
+            size_t                               _thread_count;
+            size_t                               _id_bound;
+            //CSR adjacency (forward and reverse)
+            std::vector<size_t>                  _out_offsets;
+            std::vector<size_t>                  _out_targets;
+            std::vector<size_t>                  _in_offsets;
+            std::vector<size_t>                  _in_targets;
+            //Task colour of each node (DONE once its SCC is known)
+            std::unique_ptr<std::atomic<size_t>[]> _colour;
+            std::atomic<size_t>                    _next_colour;
+            static constexpr size_t DONE = std::numeric_limits<size_t>::max();
+        };
+
+        /**
+         * Runs a function over [0, size) split into one contiguous chunk per worker thread
+         * @param size     Range size
+         * @param function Function called with ( worker index, chunk begin, chunk end )
+         */
+        template<class Function> void ParallelSCC::runChunks( const size_t &size, const Function &function ) const {
+            size_t worker_count = std::max<size_t>( 1, std::min<size_t>( _thread_count, size ) );
+            size_t chunk_size   = ( size + worker_count - 1 ) / worker_count;
+            std::vector<std::thread> workers;
+            for( size_t w = 0; w < worker_count; w++ ) {
+                workers.emplace_back( [&, w]() {
+                    function( w, std::min( size, w * chunk_size ), std::min( size, ( w + 1 ) * chunk_size ) );
+                } );
+            }
+            for( auto &worker : workers ) {
+                worker.join();
+            }
+        }
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_PARALLELSCC_H
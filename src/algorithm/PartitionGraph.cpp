@@ -1,9 +1,17 @@
 #include "PartitionGraph.h"
 
+#include <algorithm>
+
+constexpr size_t sbp::algo::PartitionGraph::NONE;
+
 /**
  * Constructor
+ * @param thread_count Number of SubGraphs built concurrently
  */
-sbp::algo::PartitionGraph::PartitionGraph() {}
+sbp::algo::PartitionGraph::PartitionGraph( const size_t &thread_count ) :
+    _thread_count( std::max<size_t>( 1, thread_count ) ),
+    _view_count( 0 )
+{}
 
 /**
  * Destructor
@@ -21,107 +29,172 @@ std::unique_ptr<std::list<sbp::graph::SubGraph>> sbp::algo::PartitionGraph::part
                                                                                            const std::list<std::list<size_t>> &scc_lists,
                                                                                            const std::string &sb_name_prefix ) {
     _sub_graphs = std::make_unique<SubGraphList_t>();
-    size_t sg_count { 0 };
+    if( scc_lists.empty() ) {
+        return std::move( _sub_graphs );
+    }
+    size_t id_bound { 0 };
+    for( const auto &node : base_graph ) {
+        id_bound = std::max( id_bound, node.first + 1 );
+    }
+    //SubGraph creation and membership of the nodes
+    std::vector<size_t> membership( id_bound, NONE ); //global ID -> SubGraph index
+    std::vector<size_t> local_ids( id_bound, NONE );  //global ID -> local ID in its SubGraph
+    std::vector<std::pair<SubGraphList_t::iterator, const std::list<size_t> *>> jobs;
     auto it = scc_lists.begin();
-    if( it != scc_lists.end() && !it->empty() ) { //Singleton SCCs
-        partitionSingletonSCCs( base_graph, *it, std::string( sb_name_prefix + std::to_string( sg_count ) ) );
-        sg_count++;
+    bool singletons = !it->empty();
+    if( !singletons ) {
+        ++it;
+    }
+    for( ; it != scc_lists.end(); ++it ) {
+        auto index = jobs.size();
+        jobs.emplace_back( _sub_graphs->emplace( _sub_graphs->end(), sb_name_prefix + std::to_string( index ) ), &( *it ) );
+        for( auto v : *it ) {
+            membership[ v ] = index;
+        }
+    }
+    //Largest SCCs first so that the workers finish at around the same time
+    std::vector<size_t> order( jobs.size() );
+    for( size_t i = 0; i < order.size(); i++ ) {
+        order[ i ] = i;
     }
-    for( it = std::next( it ); it != scc_lists.end(); ++it) { //All the other SCCs
-        partitionSCC( base_graph, *it, std::string( sb_name_prefix + std::to_string( sg_count ) ) );
-        sg_count++;
+    std::stable_sort( order.begin(), order.end(), [&]( const size_t &a, const size_t &b ) {
+        return jobs[ a ].second->size() > jobs[ b ].second->size();
+    } );
+    std::atomic<size_t> next { 0 };
+    auto worker = [&]() {
+        for( auto i = next.fetch_add( 1 ); i < order.size(); i = next.fetch_add( 1 ) ) {
+            auto index      = order[ i ];
+            auto &sub_graph = *jobs[ index ].first;
+            for( auto v : *jobs[ index ].second ) {
+                sub_graph.addNode( v );
+                local_ids[ v ] = sub_graph.getLocalID( v );
+            }
+            auto local_id = [&]( const size_t &u ) {
+                return u < id_bound && membership[ u ] == index ? local_ids[ u ] : NONE;
+            };
+            if( singletons && index == 0 ) {
+                partitionSingletonSCCs( base_graph, sub_graph, local_id );
+            } else {
+                partitionSCC( base_graph, sub_graph, local_id );
+            }
+        }
+    };
+    auto worker_count = std::min( _thread_count, jobs.size() );
+    if( worker_count <= 1 ) {
+        worker();
+    } else {
+        std::vector<std::thread> workers;
+        for( size_t w = 0; w < worker_count; w++ ) {
+            workers.emplace_back( worker );
+        }
+        for( auto &thread : workers ) {
+            thread.join();
+        }
     }
     return std::move( _sub_graphs );
 }
 
 /**
- * Partitions a graph into a SubGraph based on a non-singleton SCC
- * @param base_graph    Base graph (global) from which to partition off
- * @param scc           List of nodes of an SCC
- * @param subGraph_name Name of the created SubGraph
- * @return Iterator to the created SubGraph
+ * Partitions a graph into a SubGraph based on a single SCC (for SCCs streamed one at a time)
+ * @param base_graph      Base graph (global) from which to partition off
+ * @param scc             List of nodes of an SCC
+ * @param singletons_flag Flag for when the SCC is the concatenated list of singleton SCCs
+ * @param subGraph_name   Name of the created SubGraph
+ * @return List holding the created SubGraph
  */
-void sbp::algo::PartitionGraph::partitionSCC( const eadlib::WeightedGraph<size_t> &base_graph,
-                                              const std::list<size_t> &scc,
-                                              const std::string &subGraph_name ) {
-    auto sub_graph = _sub_graphs->emplace( _sub_graphs->end(), subGraph_name );
-    auto entrance_id = sub_graph->getSourceID();
-    auto exit_id     = sub_graph->getTerminalID();
-    //add node
+std::unique_ptr<std::list<sbp::graph::SubGraph>> sbp::algo::PartitionGraph::partition( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                                                       const std::list<size_t> &scc,
+                                                                                       const bool &singletons_flag,
+                                                                                       const std::string &subGraph_name ) {
+    _sub_graphs = std::make_unique<SubGraphList_t>();
+    auto &sub_graph = *_sub_graphs->emplace( _sub_graphs->end(), subGraph_name );
     for( auto v : scc ) {
-        sub_graph->addNode( v );
+        sub_graph.addNode( v );
     }
-    //add edges
-    for( auto it = sub_graph->begin(); it != sub_graph->end(); ++it ) {
-        if( !( it->first == entrance_id || it->first == exit_id ) ) {
-            auto v = sub_graph->getGlobalID( it->first );
-            if( !base_graph.at( v ).childrenList.empty() ) {
-                for( auto u : base_graph.at( v ).childrenList ) {
-                    auto local_u_search = sub_graph->findGlobalID( u );
-                    if( local_u_search != sub_graph->end() ) {
-                        sub_graph->createDirectedEdge( it->first, local_u_search->first );
-                    } else { //edge leaving this SCC sub-graph
-                        sub_graph->createDirectedEdge( it->first, exit_id ); //creates v->r'
-                    }
-                }
-            }
-            if( !base_graph.at( v ).parentsList.empty() ) {
-                for( auto u : base_graph.at( v ).parentsList ) {
-                    if( sub_graph->findGlobalID( u ) == sub_graph->end() ) { //not in sub-graph
-                        sub_graph->createDirectedEdge( entrance_id, it->first ); //creates r->v
-                    }
-                }
-            }
-        }
+    auto local_id = [&]( const size_t &u ) {
+        auto search = sub_graph.findGlobalID( u );
+        return search != sub_graph.end() ? search->first : NONE;
+    };
+    if( singletons_flag ) {
+        partitionSingletonSCCs( base_graph, sub_graph, local_id );
+    } else {
+        partitionSCC( base_graph, sub_graph, local_id );
     }
+    return std::move( _sub_graphs );
 }
 
 /**
- * Partitions a graph into a SubGraph based on a list of singleton SCCs
- * @param base_graph    Base graph (global) from which to partition off
- * @param scc           List of nodes of an SCC
- * @param subGraph_name Name of the created SubGraph
- * @return Iterator to the created SubGraph
+ * Creates SubGraph views of a graph based on a list of SCCs
+ * @param base_graph     Base graph (global) from which to partition off
+ * @param scc_lists      Complete list if SCCs (where first list is a concatenate of all singleton SCCs found)
+ * @param sb_name_prefix SubGraph name prefix
+ * @return List of all SubGraph views created (named and ordered as partitionSCCs(..) would)
  */
-void sbp::algo::PartitionGraph::partitionSingletonSCCs( const eadlib::WeightedGraph<size_t> &base_graph,
-                                                        const std::list<size_t> &scc,
-                                                        const std::string &subGraph_name ) {
-    auto sub_graph = _sub_graphs->emplace( _sub_graphs->begin(), subGraph_name );
-    auto entrance_id = sub_graph->getSourceID();
-    auto exit_id     = sub_graph->getTerminalID();
-    //add node
-    for( auto v : scc ) {
-        sub_graph->addNode( v );
+std::unique_ptr<std::list<sbp::graph::SubGraphView>> sbp::algo::PartitionGraph::viewSCCs( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                                                          const std::list<std::list<size_t>> &scc_lists,
+                                                                                          const std::string &sb_name_prefix ) {
+    auto views = std::make_unique<SubGraphViewList_t>();
+    if( scc_lists.empty() ) {
+        return views;
     }
-    //add edges
-    for( auto it = sub_graph->begin(); it != sub_graph->end(); ++it ) {
-        if( !( it->first == entrance_id || it->first == exit_id ) ) {
-            auto v = sub_graph->getGlobalID( it->first );
-            if( base_graph.at( v ).childrenList.empty() ) {
-                sub_graph->createDirectedEdge( it->first, exit_id ); //creates v->r'
-            } else {
-                for( auto u : base_graph.at( v ).childrenList ) {
-                    auto local_u_search = sub_graph->findGlobalID( u );
-                    if( local_u_search != sub_graph->end() ) {
-                        sub_graph->createDirectedEdge( it->first, local_u_search->first );
-                    } else { //edge leaving this SCC sub-graph
-                        sub_graph->createDirectedEdge( it->first, exit_id ); //creates v->r'
-                    }
-                }
-            }
-            if( base_graph.at( v ).parentsList.empty() ) {
-                sub_graph->createDirectedEdge( entrance_id, it->first ); //creates r->v
-            } else {
-                for( auto u : base_graph.at( v ).parentsList ) {
-                    if( sub_graph->findGlobalID( u ) == sub_graph->end() ) { //not in sub-graph
-                        sub_graph->createDirectedEdge( entrance_id, it->first ); //creates r->v
-                    }
-                }
-            }
+    _membership.reset();
+    _view_count = 0;
+    allocateMembership( base_graph );
+    auto it = scc_lists.begin();
+    bool singletons = !it->empty();
+    if( !singletons ) {
+        ++it;
+    }
+    for( ; it != scc_lists.end(); ++it ) {
+        auto index = _view_count++;
+        auto nodes = std::vector<size_t>( it->begin(), it->end() );
+        for( size_t i = 0; i < nodes.size(); i++ ) {
+            _membership->_scc[ nodes[ i ] ]      = index;
+            _membership->_local_id[ nodes[ i ] ] = i + 2;
         }
+        views->emplace_back( sb_name_prefix + std::to_string( index ), base_graph, _membership,
+                             index, std::move( nodes ), singletons && index == 0 );
     }
+    return views;
 }
 
+/**
+ * Creates a SubGraph view of a graph based on a single SCC (for SCCs streamed one at a time)
+ * @param base_graph      Base graph (global) from which to partition off
+ * @param scc             List of nodes of an SCC
+ * @param singletons_flag Flag for when the SCC is the concatenated list of singleton SCCs
+ * @param subGraph_name   Name of the created SubGraph
+ * @return List holding the created SubGraph view
+ */
+std::unique_ptr<std::list<sbp::graph::SubGraphView>> sbp::algo::PartitionGraph::view( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                                                      const std::list<size_t> &scc,
+                                                                                      const bool &singletons_flag,
+                                                                                      const std::string &subGraph_name ) {
+    auto views = std::make_unique<SubGraphViewList_t>();
+    allocateMembership( base_graph );
+    auto index = _view_count++;
+    auto nodes = std::vector<size_t>( scc.begin(), scc.end() );
+    for( size_t i = 0; i < nodes.size(); i++ ) {
+        _membership->_scc[ nodes[ i ] ]      = index;
+        _membership->_local_id[ nodes[ i ] ] = i + 2;
+    }
+    views->emplace_back( subGraph_name, base_graph, _membership, index, std::move( nodes ), singletons_flag );
+    return views;
+}
 
-
-
+/**
+ * Allocates the membership arrays for the views of a base graph if not already done
+ * @param base_graph Base graph (global)
+ */
+void sbp::algo::PartitionGraph::allocateMembership( const eadlib::WeightedGraph<size_t> &base_graph ) {
+    if( _membership ) {
+        return;
+    }
+    size_t id_bound { 0 };
+    for( const auto &node : base_graph ) {
+        id_bound = std::max( id_bound, node.first + 1 );
+    }
+    _membership = std::make_shared<graph::SubGraphView::Membership>();
+    _membership->_scc.assign( id_bound, NONE );
+    _membership->_local_id.assign( id_bound, NONE );
+}
@@ -5,37 +5,137 @@
     Implementation of the 'PartitionGraph(H)' algorithm found in the Quasi-Linear SuperBubble algorithm paper
     See the README.md
 
-    @dependencies   eadlib::WeightedGraph, sbp::graph::SubGraph
+    When partitioning a whole list of SCCs the SubGraphs are built concurrently (largest SCCs
+    first) from a membership array (global ID -> SCC index) and a local ID array
+    (global ID -> local ID in its SubGraph) instead of probing the SubGraphs' ID maps per edge.
+
+    The same arrays back the SubGraphViews which give the SubGraphs without copying the
+    adjacency of the base graph. When viewing SCCs one at a time the arrays are allocated
+    on the first call and reused for the following SCCs of the same base graph.
+
+    @dependencies   eadlib::WeightedGraph, sbp::graph::SubGraph, sbp::graph::SubGraphView
 **/
 #ifndef SUPERBUBBLE_PERFORMANCE_GRAPHPARTITIONER_H
 #define SUPERBUBBLE_PERFORMANCE_GRAPHPARTITIONER_H
 
+#include <atomic>
+#include <limits>
 #include <list>
+#include <thread>
+#include <vector>
 #include <eadlib/datastructure/WeightedGraph.h>
 #include "../graph/SubGraph.h"
+#include "../graph/SubGraphView.h"
 
 namespace sbp {
     namespace algo {
         class PartitionGraph {
           public:
-            PartitionGraph();
+            PartitionGraph( const size_t &thread_count = std::thread::hardware_concurrency() );
             ~PartitionGraph();
             //Type definition
             typedef std::list<graph::SubGraph> SubGraphList_t;
+            typedef std::list<graph::SubGraphView> SubGraphViewList_t;
             //Partitioning method
             std::unique_ptr<SubGraphList_t> partitionSCCs( const eadlib::WeightedGraph<size_t> &base_graph,
                                                            const std::list<std::list<size_t>> &scc_lists,
                                                            const std::string &sb_name_prefix );
+            std::unique_ptr<SubGraphList_t> partition( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                       const std::list<size_t> &scc,
+                                                       const bool &singletons_flag,
+                                                       const std::string &subGraph_name );
+            std::unique_ptr<SubGraphViewList_t> viewSCCs( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                          const std::list<std::list<size_t>> &scc_lists,
+                                                          const std::string &sb_name_prefix );
+            std::unique_ptr<SubGraphViewList_t> view( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                      const std::list<size_t> &scc,
+                                                      const bool &singletons_flag,
+                                                      const std::string &subGraph_name );
 
           private:
-            void partitionSCC( const eadlib::WeightedGraph<size_t> &base_graph,
-                               const std::list<size_t> &scc,
-                               const std::string &subGraph_name );
-            void partitionSingletonSCCs( const eadlib::WeightedGraph<size_t> &base_graph,
-                                         const std::list<size_t> &scc,
-                                         const std::string &subGraph_name );
-            std::unique_ptr<SubGraphList_t> _sub_graphs;
+            static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+            template<class LocalID> void partitionSCC( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                       graph::SubGraph &sub_graph,
+                                                       const LocalID &local_id ) const;
+            template<class LocalID> void partitionSingletonSCCs( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                                 graph::SubGraph &sub_graph,
+                                                                 const LocalID &local_id ) const;
+            void allocateMembership( const eadlib::WeightedGraph<size_t> &base_graph );
+            std::unique_ptr<SubGraphList_t>                  _sub_graphs;
+            size_t                                           _thread_count;
+            std::shared_ptr<graph::SubGraphView::Membership> _membership; //for the views
+            size_t                                           _view_count;
         };
+
+        /**
+         * Partitions a graph into a SubGraph based on a non-singleton SCC
+         * @param base_graph Base graph (global) from which to partition off
+         * @param sub_graph  SubGraph holding the nodes of the SCC
+         * @param local_id   Lookup of the local ID of a global node in the SubGraph (NONE when not in it)
+         */
+        template<class LocalID> void PartitionGraph::partitionSCC( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                                   graph::SubGraph &sub_graph,
+                                                                   const LocalID &local_id ) const {
+            auto entrance_id = sub_graph.getSourceID();
+            auto exit_id     = sub_graph.getTerminalID();
+            for( auto it = sub_graph.begin(); it != sub_graph.end(); ++it ) {
+                if( !( it->first == entrance_id || it->first == exit_id ) ) {
+                    const auto &node = base_graph.at( sub_graph.getGlobalID( it->first ) );
+                    for( auto u : node.childrenList ) {
+                        auto local_u = local_id( u );
+                        if( local_u != NONE ) {
+                            sub_graph.createDirectedEdge( it->first, local_u );
+                        } else { //edge leaving this SCC sub-graph
+                            sub_graph.createDirectedEdge( it->first, exit_id ); //creates v->r'
+                        }
+                    }
+                    for( auto u : node.parentsList ) {
+                        if( local_id( u ) == NONE ) { //not in sub-graph
+                            sub_graph.createDirectedEdge( entrance_id, it->first ); //creates r->v
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * Partitions a graph into a SubGraph based on a list of singleton SCCs
+         * @param base_graph Base graph (global) from which to partition off
+         * @param sub_graph  SubGraph holding the nodes of the singleton SCCs
+         * @param local_id   Lookup of the local ID of a global node in the SubGraph (NONE when not in it)
+         */
+        template<class LocalID> void PartitionGraph::partitionSingletonSCCs( const eadlib::WeightedGraph<size_t> &base_graph,
+                                                                             graph::SubGraph &sub_graph,
+                                                                             const LocalID &local_id ) const {
+            auto entrance_id = sub_graph.getSourceID();
+            auto exit_id     = sub_graph.getTerminalID();
+            for( auto it = sub_graph.begin(); it != sub_graph.end(); ++it ) {
+                if( !( it->first == entrance_id || it->first == exit_id ) ) {
+                    const auto &node = base_graph.at( sub_graph.getGlobalID( it->first ) );
+                    if( node.childrenList.empty() ) {
+                        sub_graph.createDirectedEdge( it->first, exit_id ); //creates v->r'
+                    } else {
+                        for( auto u : node.childrenList ) {
+                            auto local_u = local_id( u );
+                            if( local_u != NONE ) {
+                                sub_graph.createDirectedEdge( it->first, local_u );
+                            } else { //edge leaving this SCC sub-graph
+                                sub_graph.createDirectedEdge( it->first, exit_id ); //creates v->r'
+                            }
+                        }
+                    }
+                    if( node.parentsList.empty() ) {
+                        sub_graph.createDirectedEdge( entrance_id, it->first ); //creates r->v
+                    } else {
+                        for( auto u : node.parentsList ) {
+                            if( local_id( u ) == NONE ) { //not in sub-graph
+                                sub_graph.createDirectedEdge( entrance_id, it->first ); //creates r->v
+                            }
+                        }
+                    }
+                }
+            }
+        }
     }
 }
 
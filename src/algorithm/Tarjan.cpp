@@ -19,114 +19,197 @@ sbp::algo::Tarjan::~Tarjan() {}
 /**
  * Finds Strongly Connected Components in the Graph
  * @return List of strongly connected components with the first one being a concatenated list of singleton SCCs
+ *         (empty if there are none)
  */
 std::unique_ptr<sbp::algo::Tarjan::SCCList_t> sbp::algo::Tarjan::findSCCs() {
-    _scc = std::make_unique<SCCList_t>();
-    //Error control
-    if( _graph.isEmpty() ) {
-        LOG_ERROR( "[sbp::algo::Tarjan::getSCCs()] Graph is empty." );
-        return std::move( _scc );
+    auto scc_list = std::make_unique<SCCList_t>();
+    auto sccs     = SCCArray();
+    if( !findSCCs( sccs ) ) {
+        return scc_list;
     }
-    //Setting up containers...
-    std::unordered_map<size_t, Discovery> discovery;
-    std::stack<size_t>  stack;
-    std::vector<bool>   stackMember( _graph.nodeCount(), false );
-    //Finding SCCs...
-    size_t index { 0 };
-    for( auto it = _graph.begin(); it != _graph.end(); ++it ) {
-        if( discovery.find( it->first ) == discovery.end() ) { //i.e. not discovered yet
-            findSCCs( it->first, index, discovery, stack, stackMember );
-        }
+    for( size_t i = 0; i < sccs.size(); i++ ) {
+        scc_list->emplace_back( sccs._members.begin() + sccs._offsets.at( i ),
+                                sccs._members.begin() + sccs._offsets.at( i + 1 ) );
+    }
+    return scc_list;
+}
+
+/**
+ * Finds Strongly Connected Components in the Graph
+ * @param sccs Flat SCC list to fill (SCC 0 is the concatenated list of singleton SCCs, possibly empty)
+ * @return Success
+ */
+bool sbp::algo::Tarjan::findSCCs( SCCArray &sccs ) {
+    sccs._offsets.assign( 1, 0 );
+    sccs._members.clear();
+    std::vector<size_t> singletons;
+    std::vector<size_t> cyclic_offsets { 0 };
+    std::vector<size_t> cyclic_members;
+    auto emit = [&]( const SCCIterator_t &begin, const SCCIterator_t &end ) {
+        cyclic_members.insert( cyclic_members.end(), begin, end );
+        cyclic_offsets.emplace_back( cyclic_members.size() );
+    };
+    if( !search( singletons, emit ) ) {
+        return false;
+    }
+    //Singletons then the other SCCs in the order found
+    sccs._members.reserve( singletons.size() + cyclic_members.size() );
+    sccs._members.insert( sccs._members.end(), singletons.begin(), singletons.end() );
+    sccs._members.insert( sccs._members.end(), cyclic_members.begin(), cyclic_members.end() );
+    sccs._offsets.reserve( cyclic_offsets.size() + 1 );
+    for( auto offset : cyclic_offsets ) {
+        sccs._offsets.emplace_back( singletons.size() + offset );
+    }
+    return true;
+}
+
+/**
+ * Finds Strongly Connected Components in the Graph and passes each one on as soon as it is complete
+ * (non-singleton SCCs first in the order found, then the concatenated list of singleton SCCs if there are any)
+ * @param callback Function called with each SCC
+ * @return Success
+ */
+bool sbp::algo::Tarjan::findSCCs( const SCCCallback_t &callback ) {
+    std::vector<size_t> singletons;
+    auto emit = [&]( const SCCIterator_t &begin, const SCCIterator_t &end ) {
+        callback( std::list<size_t>( begin, end ), false );
+    };
+    if( !search( singletons, emit ) ) {
+        return false;
+    }
+    if( !singletons.empty() ) {
+        callback( std::list<size_t>( singletons.begin(), singletons.end() ), true );
     }
-    concatenateSingletonSCCs();
-    return std::move( _scc );
+    return true;
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------------------
 // Tarjan class private method implementations
 //--------------------------------------------------------------------------------------------------------------------------------------------
 /**
- * Finds SCCs recursively using DFS
- * @param vertex_id   Vertex ID
- * @param index       Reach index counter
- * @param discovery   Discovery index & low link
- * @param stack       Stack to store the connected ancestor
- * @param stackMember Container holding the record of whether a node is a member of the stack or not
+ * Searches the graph for SCCs
+ * @param singletons Container for the singleton SCCs (trimmed ones in peeling order, then the DFS ones latest found first)
+ * @param emit       Function called with the node range of each non-singleton SCC found (from the root up)
+ * @return Success
  */
-void sbp::algo::Tarjan::findSCCs( const size_t &vertex_id,
-                                  size_t &index,
-                                  std::unordered_map<size_t, Discovery> &discovery,
-                                  std::stack<size_t> &stack,
-                                  std::vector<bool> &stackMember ) {
-
-    // Set the depth index for v to the smallest unused index
-    auto d = discovery.find( vertex_id );
-    if( d == discovery.end() ) { //never discovered
-        d = discovery.insert( std::make_pair( vertex_id, Discovery( index, index ) ) ).first;
-    } else { //update index
-        d->second._index    = index;
-        d->second._low_link = index;
+bool sbp::algo::Tarjan::search( std::vector<size_t> &singletons, const Emitter_t &emit ) {
+    //Error control
+    if( _graph.isEmpty() ) {
+        LOG_ERROR( "[sbp::algo::Tarjan::search( <singletons>, <emit> )] Graph is empty." );
+        return false;
     }
-    index++;
-    stack.push( vertex_id );
-    stackMember.at( vertex_id ) = true;
-
-    // Consider successors of v
-    auto v = _graph.at( vertex_id );
-    for( auto w = v.childrenList.begin(); w != v.childrenList.end(); ++w ) {
-        if( discovery.find( *w ) == discovery.end() ) { //index is undefined
-            // Successor w has not yet been visited; recurse on it
-            findSCCs( *w, index, discovery, stack, stackMember );
-            d->second._low_link = std::min( d->second._low_link, discovery.at( *w )._low_link );
-        } else if( stackMember.at( *w ) ) {
-            // Successor w is in stack and hence in the current SCC
-            d->second._low_link = std::min( d->second._low_link, discovery.at( *w )._index );
-        }
+    //Setting up containers...
+    size_t id_bound { 0 };
+    for( const auto &node : _graph ) {
+        id_bound = std::max( id_bound, node.first + 1 );
     }
+    const size_t UNDEFINED = std::numeric_limits<size_t>::max();
+    const size_t TRIMMED   = UNDEFINED - 1;
+    std::vector<size_t> index( id_bound, UNDEFINED );
+    std::vector<size_t> low_link( id_bound, 0 );
+    std::vector<bool>   stack_member( id_bound, false );
+    std::vector<size_t> stack;
+    std::vector<Frame>  call_stack;
+    std::vector<size_t> dfs_singletons;
+    size_t counter { 0 };
+    //Peeling off the trivial singletons (seen as discovered and off the stack by the DFS)
+    singletons.clear();
+    trim( index, TRIMMED, singletons );
+    LOG_DEBUG( "[sbp::algo::Tarjan::search( <singletons>, <emit> )] ", singletons.size(), "/", _graph.nodeCount(), " nodes trimmed." );
 
+    /**
+     * [Lambda] Sets the depth index for v to the smallest unused index and schedules the visit of its successors
+     */
+    auto discover = [&]( const size_t &v ) {
+        index.at( v )    = counter;
+        low_link.at( v ) = counter;
+        counter++;
+        stack.emplace_back( v );
+        stack_member.at( v ) = true;
+        const auto &children = _graph.at( v ).childrenList;
+        call_stack.emplace_back( Frame( v, children.cbegin(), children.cend() ) );
+    };
 
-    // If v is a root node, pop the stack and generate an SCC
-    if( d->second._low_link == d->second._index ) {
-        //start a new strongly connected component
-        std::list<size_t> scc;
-        if( stack.top() == vertex_id ) { //singleton SCC
-            scc.emplace_back( stack.top() );
-            stackMember.at( stack.top() ) = false;
-            stack.pop();
-            //add SCC to front of list
-            _scc->emplace_front( scc );
-        } else { //non-singleton SCC
-            while( stack.top() != vertex_id ) {
-                //add w to current SCC
-                scc.emplace_front( stack.top() );
-                stackMember.at( stack.top() ) = false;
-                stack.pop();
+    //Finding SCCs...
+    for( auto it = _graph.begin(); it != _graph.end(); ++it ) {
+        if( index.at( it->first ) != UNDEFINED ) { //i.e. already discovered
+            continue;
+        }
+        discover( it->first );
+        while( !call_stack.empty() ) {
+            auto &frame = call_stack.back();
+            if( frame._next_child != frame._end ) { //Consider next successor of v
+                auto v = frame._node;
+                auto w = *frame._next_child;
+                ++frame._next_child;
+                if( index.at( w ) == UNDEFINED ) {
+                    // Successor w has not yet been visited; visit it
+                    discover( w );
+                } else if( stack_member.at( w ) ) {
+                    // Successor w is in stack and hence in the current SCC
+                    low_link.at( v ) = std::min( low_link.at( v ), index.at( w ) );
+                }
+                continue;
+            }
+            //All successors of v considered
+            auto v = frame._node;
+            call_stack.pop_back();
+            if( low_link.at( v ) == index.at( v ) ) { //v is a root node: pop the stack and generate an SCC
+                if( stack.back() == v ) { //singleton SCC
+                    dfs_singletons.emplace_back( v );
+                    stack_member.at( v ) = false;
+                    stack.pop_back();
+                } else { //non-singleton SCC (from the root up)
+                    auto root = stack.end();
+                    do {
+                        --root;
+                        stack_member.at( *root ) = false;
+                    } while( *root != v );
+                    emit( root, stack.cend() );
+                    stack.erase( root, stack.end() );
+                }
+            }
+            if( !call_stack.empty() ) { //propagate the low link to the parent
+                auto u = call_stack.back()._node;
+                low_link.at( u ) = std::min( low_link.at( u ), low_link.at( v ) );
             }
-            scc.emplace_front( stack.top() );
-            stackMember.at( stack.top() ) = false;
-            stack.pop();
-            //add SCC to back of list
-            _scc->emplace_back( scc );
         }
     }
+    singletons.insert( singletons.end(), dfs_singletons.rbegin(), dfs_singletons.rend() );
+    return true;
 }
 
 /**
- * Concatenate all singletons SCCs into the first list of SCCs passed
- * @param scc_list List of SCCs
+ * Repeatedly removes the nodes with no in-coming or no out-going edges among the remaining nodes
+ * (none of these can be on a cycle so they are all singleton SCCs)
+ * @param index      Node index array where the removed nodes are marked
+ * @param trimmed    Index value marking a removed node
+ * @param singletons Container for the removed nodes (in removal order)
  */
-void sbp::algo::Tarjan::concatenateSingletonSCCs() {
-    auto first = _scc->begin();
-    auto next  = _scc->begin();
-    if( first != _scc->end() && _scc->size() > 1 ) {
-        if( first->size() == 1 ) {
-            next++;
-            while( next != _scc->end() && next->size() == 1 ) {
-                first->emplace_back( next->front() );
-                next = _scc->erase( next );
+void sbp::algo::Tarjan::trim( std::vector<size_t> &index, const size_t &trimmed, std::vector<size_t> &singletons ) const {
+    std::vector<size_t> in_degree( index.size(), 0 );
+    std::vector<size_t> out_degree( index.size(), 0 );
+    for( const auto &node : _graph ) {
+        in_degree[ node.first ]  = node.second.parentsList.size();
+        out_degree[ node.first ] = node.second.childrenList.size();
+        if( in_degree[ node.first ] == 0 || out_degree[ node.first ] == 0 ) {
+            index[ node.first ] = trimmed;
+            singletons.emplace_back( node.first );
+        }
+    }
+    for( size_t i = 0; i < singletons.size(); i++ ) { //grows as more nodes are removed
+        const auto &node = _graph.at( singletons[ i ] );
+        for( const auto &child : node.childrenList ) {
+            if( --in_degree[ child ] == 0 && index[ child ] != trimmed ) {
+                index[ child ] = trimmed;
+                singletons.emplace_back( child );
+            }
+        }
+        for( const auto &parent : node.parentsList ) {
+            if( --out_degree[ parent ] == 0 && index[ parent ] != trimmed ) {
+                index[ parent ] = trimmed;
+                singletons.emplace_back( parent );
             }
-        } else { //add empty singleton list for consistency
-            _scc->emplace_front( std::list<size_t>() );
         }
     }
 }
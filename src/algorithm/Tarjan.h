@@ -5,6 +5,18 @@
                     SCCs found are ordered so that singletons are placed
                     at the front of the list and the rest at the back
 
+                    Nodes with no in-coming or no out-going edges among the
+                    remaining nodes are peeled off as singletons first so the
+                    DFS only runs over the cyclic core of the graph.
+
+                    SCCs can also be streamed to a callback as they are found
+                    so that they can be processed (and freed) one at a time.
+
+                    The DFS is iterative (explicit call stack) and uses dense
+                    index/low-link arrays over the node IDs so it doesn't
+                    recurse nor hash on large graphs. Node IDs are expected
+                    to be dense (i.e. [0, node count)).
+
     @dependencies   eadlib::WeightedGraph<T>, eadlib::logger::Logger
     @author         E. A. Davison
     @copyright      E. A. Davison 2016
@@ -13,6 +25,12 @@
 #ifndef SUPERBUBBLE_PERFORMANCE_TARJAN_H
 #define SUPERBUBBLE_PERFORMANCE_TARJAN_H
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <vector>
 #include <eadlib/logger/Logger.h>
 #include <eadlib/datastructure/WeightedGraph.h>
 
@@ -20,33 +38,41 @@ namespace sbp {
     namespace algo {
         class Tarjan {
           public:
+            //Flat SCC list (SCC i holds _members[ _offsets[i], _offsets[i+1] ) and SCC 0 is the concatenation of all singletons)
+            struct SCCArray {
+                size_t size() const { return _offsets.empty() ? 0 : _offsets.size() - 1; }
+                std::vector<size_t> _offsets;
+                std::vector<size_t> _members;
+            };
+            //Callback for streamed SCCs (the singletons flag is set for the concatenated list of singleton SCCs)
+            typedef std::function<void( const std::list<size_t> &scc, const bool &singletons )> SCCCallback_t;
             Tarjan( const eadlib::WeightedGraph<size_t> &graph );
             ~Tarjan();
             std::unique_ptr<std::list<std::list<size_t>>> findSCCs();
+            bool findSCCs( SCCArray &sccs );
+            bool findSCCs( const SCCCallback_t &callback );
           private:
             //Type definition
             typedef std::list<std::list<size_t>> SCCList_t;
+            typedef std::list<size_t>::const_iterator ChildIterator_t;
+            typedef std::vector<size_t>::const_iterator SCCIterator_t;
+            typedef std::function<void( const SCCIterator_t &begin, const SCCIterator_t &end )> Emitter_t;
             //Structure definition
-            struct Discovery {
-                Discovery( const size_t &index, const size_t &lowest ) :
-                    _index( index ),
-                    _low_link( lowest )
+            struct Frame {
+                Frame( const size_t &node, const ChildIterator_t &next_child, const ChildIterator_t &end ) :
+                    _node( node ),
+                    _next_child( next_child ),
+                    _end( end )
                 {}
-                ~Discovery() {};
-                size_t _index;
-                size_t _low_link;
+                size_t          _node;
+                ChildIterator_t _next_child;
+                ChildIterator_t _end;
             };
             //Private functions
-            void findSCCs( const size_t &vertex_id,
-                           size_t &index,
-                           std::unordered_map<size_t, Discovery> &discovery,
-                           std::stack<size_t> &stack,
-                           std::vector<bool> &stackMember );
-            //Concatenating function
-            void concatenateSingletonSCCs();
+            bool search( std::vector<size_t> &singletons, const Emitter_t &emit );
+            void trim( std::vector<size_t> &index, const size_t &trimmed, std::vector<size_t> &singletons ) const;
             //Private variables
             const eadlib::WeightedGraph<size_t> &_graph;
-            std::unique_ptr<SCCList_t> _scc;
         };
     }
 }
@@ -0,0 +1,136 @@
+#include "WeakComponents.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+//--------------------------------------------------------------------------------------------------------------------------------------------
+// WeakComponents class public method implementations
+//--------------------------------------------------------------------------------------------------------------------------------------------
+/**
+ * Constructor
+ * @param graph deBruijn MultiGraph
+ */
+sbp::algo::WeakComponents::WeakComponents( const eadlib::WeightedGraph<size_t> &graph ) :
+    _graph( graph )
+{}
+
+/**
+ * Destructor
+ */
+sbp::algo::WeakComponents::~WeakComponents() {}
+
+/**
+ * Finds the weakly connected components of the graph
+ * @return Success
+ */
+bool sbp::algo::WeakComponents::findWCCs() {
+    _components.clear();
+    _local_ids.clear();
+    //Error control
+    if( _graph.isEmpty() ) {
+        LOG_ERROR( "[sbp::algo::WeakComponents::findWCCs()] Graph is empty." );
+        return false;
+    }
+    size_t id_bound { 0 };
+    for( const auto &node : _graph ) {
+        id_bound = std::max( id_bound, node.first + 1 );
+    }
+    std::vector<size_t> parent( id_bound );
+    std::vector<size_t> size( id_bound, 1 );
+    std::vector<bool>   present( id_bound, false );
+    std::iota( parent.begin(), parent.end(), 0 );
+    //Union of the end nodes of every edge
+    for( const auto &node : _graph ) {
+        present[ node.first ] = true;
+        for( const auto &child : node.second.childrenList ) {
+            auto a = findRoot( parent, node.first );
+            auto b = findRoot( parent, child );
+            if( a != b ) {
+                if( size[ a ] < size[ b ] ) {
+                    std::swap( a, b );
+                }
+                parent[ b ] = a;
+                size[ a ] += size[ b ];
+            }
+        }
+    }
+    //Numbering components in order of their smallest node
+    const size_t NONE = std::numeric_limits<size_t>::max();
+    std::vector<size_t> component_of_root( id_bound, NONE );
+    _local_ids.assign( id_bound, NONE );
+    for( size_t v = 0; v < id_bound; v++ ) {
+        if( present[ v ] ) {
+            auto root = findRoot( parent, v );
+            if( component_of_root[ root ] == NONE ) {
+                component_of_root[ root ] = _components.size();
+                _components.emplace_back();
+                _components.back().reserve( size[ root ] );
+            }
+            auto &component = _components[ component_of_root[ root ] ];
+            _local_ids[ v ] = component.size();
+            component.emplace_back( v );
+        }
+    }
+    LOG_DEBUG( "[sbp::algo::WeakComponents::findWCCs()] ", _components.size(), " components found in ", _graph.nodeCount(), " nodes." );
+    return true;
+}
+
+/**
+ * Gets the number of components found
+ * @return Component count
+ */
+size_t sbp::algo::WeakComponents::size() const {
+    return _components.size();
+}
+
+/**
+ * Gets the nodes of a component
+ * @param component Component index
+ * @return Global node IDs of the component indexed by their local ID
+ * @throws std::out_of_range when the component index is out of range
+ */
+const std::vector<size_t> & sbp::algo::WeakComponents::getNodes( const size_t &component ) const {
+    return _components.at( component );
+}
+
+/**
+ * Extracts a component into a graph of its own using local node IDs (see getNodes(..) for the translation)
+ * @param component       Component index
+ * @param component_graph Empty graph container for the component
+ * @return Success
+ */
+bool sbp::algo::WeakComponents::extract( const size_t &component, eadlib::WeightedGraph<size_t> &component_graph ) const {
+    if( component >= _components.size() ) {
+        LOG_ERROR( "[sbp::algo::WeakComponents::extract( ", component, ", <WeightedGraph> )] Component index out of range." );
+        return false;
+    }
+    const auto &nodes = _components[ component ];
+    for( size_t local = 0; local < nodes.size(); local++ ) {
+        const auto &node = _graph.at( nodes[ local ] );
+        if( node.childrenList.empty() && node.parentsList.empty() ) {
+            component_graph.addNode( local );
+        }
+        for( const auto &child : node.childrenList ) {
+            component_graph.createDirectedEdge_fast( local, _local_ids[ child ], node.weight.at( child ) );
+        }
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------------------------
+// WeakComponents class private method implementations
+//--------------------------------------------------------------------------------------------------------------------------------------------
+/**
+ * Finds the root of a node's set (halving the path on the way)
+ * @param parent Parent of each node in the union-find forest
+ * @param v      Node
+ * @return Root node of the set
+ */
+size_t sbp::algo::WeakComponents::findRoot( std::vector<size_t> &parent, size_t v ) const {
+    while( parent[ v ] != v ) {
+        parent[ v ] = parent[ parent[ v ] ];
+        v = parent[ v ];
+    }
+    return v;
+}
@@ -0,0 +1,42 @@
+/**
+    @class          sbp::algo::WeakComponents
+    @brief          Algorithm to find the weakly connected components of a graph
+
+                    Union-find (union by size with path halving) over the edges of the
+                    graph. Components are ordered by their smallest node ID and hold
+                    their node IDs in ascending order, so the position of a node in its
+                    component can be used as its local ID in the extracted component graph.
+                    Node IDs are expected to be dense (i.e. [0, node count)).
+
+    @dependencies   eadlib::WeightedGraph<T>, eadlib::logger::Logger
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2017
+    @license        GNUv2 Public License
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_WEAKCOMPONENTS_H
+#define SUPERBUBBLE_PERFORMANCE_WEAKCOMPONENTS_H
+
+#include <vector>
+#include <eadlib/logger/Logger.h>
+#include <eadlib/datastructure/WeightedGraph.h>
+
+namespace sbp {
+    namespace algo {
+        class WeakComponents {
+          public:
+            WeakComponents( const eadlib::WeightedGraph<size_t> &graph );
+            ~WeakComponents();
+            bool findWCCs();
+            size_t size() const;
+            const std::vector<size_t> & getNodes( const size_t &component ) const;
+            bool extract( const size_t &component, eadlib::WeightedGraph<size_t> &component_graph ) const;
+          private:
+            size_t findRoot( std::vector<size_t> &parent, size_t v ) const;
+            const eadlib::WeightedGraph<size_t> &_graph;
+            std::vector<std::vector<size_t>>     _components; //component -> local ID -> global ID
+            std::vector<size_t>                  _local_ids;  //global ID -> local ID
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_WEAKCOMPONENTS_H
@@ -0,0 +1,88 @@
+#include "SB_Dominators.h"
+
+/**
+ * Constructor
+ * @param graph        Graph on which to detect superbubbles
+ * @param thread_count Number of threads the SCC search, partitioning and DAG conversion may use
+ */
+sbp::algo::SB_Dominators::SB_Dominators( const eadlib::WeightedGraph<size_t> &graph, const size_t &thread_count ) :
+    _graph( graph ),
+    _thread_count( std::max<size_t>( 1, thread_count ) )
+{}
+
+/**
+ * Destructor
+ */
+sbp::algo::SB_Dominators::~SB_Dominators() {}
+
+/**
+ * Runs the dominator tree SuperBubble identification algorithm
+ * @param superbubble_list SuperBubble list container to fill
+ * @return Success
+ */
+bool sbp::algo::SB_Dominators::run( std::list<sbp::algo::container::SuperBubble> &superbubble_list ) {
+    size_t sg_count { 0 };
+    //Each SCC goes through partitioning, DAG conversion and detection as soon as it's found and is then freed
+    //(SubGraphs are viewed over the graph rather than copied out of it)
+    PartitionGraph partitioner( _thread_count );
+    auto process = [&]( const std::list<size_t> &scc, const bool &singletons ) {
+        auto id          = std::to_string( singletons ? 0 : ++sg_count );
+        auto sub_graph   = partitioner.view( _graph, scc, singletons, "SubGraph" + id );
+        auto dag_package = GraphToDAG( _thread_count ).convert( sub_graph->front(), "DAG" + id );
+        detect( dag_package->front(), sub_graph->front(), superbubble_list );
+    };
+    auto found = _graph.nodeCount() >= ParallelSCC::MIN_PARALLEL_NODES
+                 ? ParallelSCC( _graph, _thread_count ).findSCCs( process )
+                 : Tarjan( _graph ).findSCCs( process );
+    if( !found ) {
+        LOG_ERROR( "[sbp::algo::SB_Dominators::run( <SuperBubble list> )] Could not find the SCCs of the graph." );
+    }
+    return found;
+}
+
+/**
+ * Adds a node to a dominator tree
+ * (the jump pointer skips to the parent's jump target's jump target when the parent's two jumps have the
+ * same length, otherwise to the parent: any ancestor can then be reached in O(log n) jumps)
+ * @param tree   Dominator tree
+ * @param node   Node ID
+ * @param parent Node ID of the immediate (post-)dominator (already in the tree)
+ */
+void sbp::algo::SB_Dominators::addToTree( DominatorTree &tree,
+                                       const size_t &node,
+                                       const size_t &parent ) const {
+    auto jump = tree._jump[ parent ];
+    tree._parent[ node ] = parent;
+    tree._depth[ node ]  = tree._depth[ parent ] + 1;
+    tree._jump[ node ]   = tree._depth[ parent ] - tree._depth[ jump ] == tree._depth[ jump ] - tree._depth[ tree._jump[ jump ] ]
+                           ? tree._jump[ jump ]
+                           : parent;
+}
+
+/**
+ * Finds the lowest common ancestor of two nodes in a dominator tree
+ * @param tree Dominator tree
+ * @param u    Node ID
+ * @param v    Node ID
+ * @return Node ID of the lowest common ancestor
+ */
+size_t sbp::algo::SB_Dominators::findCommonAncestor( const DominatorTree &tree,
+                                                  size_t u,
+                                                  size_t v ) const {
+    if( tree._depth[ u ] < tree._depth[ v ] ) {
+        std::swap( u, v );
+    }
+    while( tree._depth[ u ] > tree._depth[ v ] ) {
+        u = tree._depth[ tree._jump[ u ] ] >= tree._depth[ v ] ? tree._jump[ u ] : tree._parent[ u ];
+    }
+    while( u != v ) { //jump pointers only depend on the depth so u and v stay level
+        if( tree._jump[ u ] != tree._jump[ v ] ) {
+            u = tree._jump[ u ];
+            v = tree._jump[ v ];
+        } else {
+            u = tree._parent[ u ];
+            v = tree._parent[ v ];
+        }
+    }
+    return u;
+}
@@ -0,0 +1,202 @@
+/**
+    @class          sbp::algo::SB_Dominators
+    @brief          Implementation of an O(m log m) superbubble algorithm based on dominator trees
+
+                    The graph is reduced to DAGs as in sbp::algo::SB_QLinear but the detection on each DAG is
+                    not the one from Sung et al. (no entrance/exit search).
+
+                    The superbubbles of each DAG are found from its dominator and post-dominator trees:
+                    (s, t) is a superbubble when t is the immediate post-dominator of s and s is the immediate
+                    dominator of t. The immediate (post-)dominator of a node is the lowest common ancestor of its
+                    parents (children) in the tree built so far in (reverse) topological order. The trees keep a
+                    jump pointer per node so that each ancestor query takes O(log n): O(m log n) overall.
+
+    @dependencies   eadlib::WeightedGraph<T>, eadlib::Graph<T>,
+                    sbp::algo::container::SuperBubble, sbp::algo::container::SuperBubbleReporter, sbp::algo::Tarjan, sbp::algo::ParallelSCC, sbp::algo::GraphToDAG
+
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2016
+    @license        GNUv2 Public License
+**/
+
+#ifndef SUPERBUBBLE_PERFORMANCE_SB_DOMINATORS_H
+#define SUPERBUBBLE_PERFORMANCE_SB_DOMINATORS_H
+
+#include <vector>
+#include <memory>
+
+#include <eadlib/datastructure/Graph.h>
+#include <eadlib/datastructure/WeightedGraph.h>
+
+#include "container/SuperBubble.h"
+#include "container/SuperBubbleReporter.h"
+#include "../Tarjan.h"
+#include "../ParallelSCC.h"
+#include "../PartitionGraph.h"
+#include "../GraphToDAG.h"
+
+namespace sbp {
+    namespace algo {
+        class SB_Dominators {
+          public:
+            SB_Dominators( const eadlib::WeightedGraph<size_t> &graph,
+                           const size_t &thread_count = std::thread::hardware_concurrency() );
+            ~SB_Dominators();
+            bool run( std::list<container::SuperBubble> &superbubble_list );
+          private:
+            struct DominatorTree {
+                DominatorTree( const size_t &node_count, const size_t &root ) :
+                    _parent( node_count, root ),
+                    _jump( node_count, root ),
+                    _depth( node_count, 0 )
+                {}
+                std::vector<size_t> _parent; //immediate (post-)dominator
+                std::vector<size_t> _jump;   //ancestor to skip to when going up the tree
+                std::vector<size_t> _depth;
+            };
+
+            template<class DAG_Package_t, class SubGraph_t> void detect( const DAG_Package_t &dag_package,
+                                                                         const SubGraph_t &sub_graph,
+                                                                         std::list<container::SuperBubble> &superbubble_list );
+
+            template<class DAG_t> void fillTopologicalOrder( const DAG_t &dag,
+                                                             std::vector<size_t> &order ) const;
+
+            template<class DAG_t> void findDominators( const DAG_t &dag,
+                                                       const std::vector<size_t> &order,
+                                                       DominatorTree &dominators ) const;
+
+            template<class DAG_t> void findPostDominators( const DAG_t &dag,
+                                                           const std::vector<size_t> &order,
+                                                           DominatorTree &post_dominators ) const;
+
+            void addToTree( DominatorTree &tree,
+                            const size_t &node,
+                            const size_t &parent ) const;
+
+            size_t findCommonAncestor( const DominatorTree &tree,
+                                       size_t u,
+                                       size_t v ) const;
+
+            const eadlib::WeightedGraph<size_t> &_graph;
+            size_t                _thread_count;
+        };
+
+        /**
+         * Detects the SuperBubbles in a DAG
+         * @param dag_package      DAG package of an SCC (explicit or implicit DAG)
+         * @param sub_graph        SubGraph the DAG was converted from (for the global IDs)
+         * @param superbubble_list SuperBubble list container to fill
+         */
+        template<class DAG_Package_t, class SubGraph_t> void SB_Dominators::detect( const DAG_Package_t &dag_package,
+                                                                                 const SubGraph_t &sub_graph,
+                                                                                 std::list<container::SuperBubble> &superbubble_list ) {
+            const auto &dag = dag_package._dag;
+            if( dag.nodeCount() <= 2 ) {
+                return;
+            }
+            auto order = std::vector<size_t>();
+            fillTopologicalOrder( dag, order );
+            auto dominators      = DominatorTree( dag.nodeCount(), dag.getSourceID() );
+            auto post_dominators = DominatorTree( dag.nodeCount(), dag.getTerminalID() );
+            findDominators( dag, order, dominators );
+            findPostDominators( dag, order, post_dominators );
+            auto reporter = container::SuperBubbleReporter<decltype( dag_package._dag ), SubGraph_t>( dag, sub_graph, superbubble_list );
+            for( auto s : order ) {
+                auto t = post_dominators._parent[ s ];
+                if( s != dag.getTerminalID() && t != dag.getTerminalID() && dominators._parent[ t ] == s ) {
+                    reporter.report( s, t );
+                }
+            }
+        }
+
+        /**
+         * Fills a vector with the node IDs of a DAG in topological order (r first and r' last)
+         * @param dag   DAG
+         * @param order Container for node IDs in topological order
+         */
+        template<class DAG_t> void SB_Dominators::fillTopologicalOrder( const DAG_t &dag,
+                                                                     std::vector<size_t> &order ) const {
+            auto in_degree = std::vector<size_t>( dag.nodeCount() );
+            order.reserve( dag.nodeCount() );
+            order.emplace_back( dag.getSourceID() );
+            for( size_t node = 0; node < dag.nodeCount(); node++ ) {
+                if( node != dag.getSourceID() && node != dag.getTerminalID() ) {
+                    in_degree[ node ] = dag.getInDegree( node );
+                    if( in_degree[ node ] == 0 ) {
+                        order.emplace_back( node );
+                    }
+                }
+            }
+            for( size_t i = 0; i < order.size(); i++ ) {
+                auto   cursor = dag.childCursor( order[ i ] );
+                size_t child { 0 };
+                while( dag.nextChild( cursor, child ) ) {
+                    if( child != dag.getTerminalID() && --in_degree[ child ] == 0 ) {
+                        order.emplace_back( child );
+                    }
+                }
+            }
+            order.emplace_back( dag.getTerminalID() );
+        }
+
+        /**
+         * Builds the dominator tree of a DAG rooted on r
+         * Nodes without parents or with parents missing from their copy in the DAG are dominated by r only.
+         * @param dag        DAG
+         * @param order      Node IDs in topological order
+         * @param dominators Dominator tree rooted on r
+         */
+        template<class DAG_t> void SB_Dominators::findDominators( const DAG_t &dag,
+                                                               const std::vector<size_t> &order,
+                                                               DominatorTree &dominators ) const {
+            for( auto node_id : order ) {
+                if( node_id == dag.getSourceID() ) {
+                    continue;
+                }
+                auto node = dag.at( node_id );
+                if( node.parentsList.empty() || dag.hasMissingParents( node_id ) ) {
+                    addToTree( dominators, node_id, dag.getSourceID() );
+                } else {
+                    auto it        = node.parentsList.begin();
+                    auto dominator = *it;
+                    while( ++it != node.parentsList.end() ) {
+                        dominator = findCommonAncestor( dominators, dominator, *it );
+                    }
+                    addToTree( dominators, node_id, dominator );
+                }
+            }
+        }
+
+        /**
+         * Builds the post-dominator tree of a DAG rooted on r'
+         * Nodes without children or with children missing from their copy in the DAG are post-dominated by r' only.
+         * @param dag             DAG
+         * @param order           Node IDs in topological order
+         * @param post_dominators Post-dominator tree rooted on r'
+         */
+        template<class DAG_t> void SB_Dominators::findPostDominators( const DAG_t &dag,
+                                                                   const std::vector<size_t> &order,
+                                                                   DominatorTree &post_dominators ) const {
+            for( auto it = order.rbegin(); it != order.rend(); ++it ) {
+                if( *it == dag.getTerminalID() ) {
+                    continue;
+                }
+                auto   cursor = dag.childCursor( *it );
+                size_t child { 0 };
+                if( dag.hasMissingChildren( *it ) || !dag.nextChild( cursor, child ) ) {
+                    addToTree( post_dominators, *it, dag.getTerminalID() );
+                } else {
+                    auto post_dominator = child;
+                    while( dag.nextChild( cursor, child ) ) {
+                        post_dominator = findCommonAncestor( post_dominators, post_dominator, child );
+                    }
+                    addToTree( post_dominators, *it, post_dominator );
+                }
+            }
+        }
+    }
+}
+
+
+#endif //SUPERBUBBLE_PERFORMANCE_SB_DOMINATORS_H
@@ -1,11 +1,15 @@
 #include "SB_Driver.h"
 
+#include <algorithm>
+
 /**
  * Constructor
- * @param writer FileWriter used to save runtime benchmarks
+ * @param writer       FileWriter used to save runtime benchmarks
+ * @param thread_count Number of threads shared between the concurrently processed components
  */
-sbp::algo::SB_Driver::SB_Driver( eadlib::io::FileWriter &writer ) :
-    _writer( writer )
+sbp::algo::SB_Driver::SB_Driver( eadlib::io::FileWriter &writer, const size_t &thread_count ) :
+    _writer( writer ),
+    _thread_count( std::max<size_t>( 1, thread_count ) )
 {}
 
 /**
@@ -17,34 +21,181 @@ sbp::algo::SB_Driver::~SB_Driver() {}
  * Runs the O(n + m) time superbubble identification algorithm
  * @param graph   Graph to detect superbubbles on
  * @param sb_list List to store SuperBubbles found into
+ * @return Success
  */
-void sbp::algo::SB_Driver::runLinear( const eadlib::WeightedGraph<size_t> &graph,
+bool sbp::algo::SB_Driver::runLinear( const eadlib::WeightedGraph<size_t> &graph,
                                       std::list<container::SuperBubble> &sb_list ) {
     auto timer  = sbp::chrono::Timer();
     timer.mark( "start" );
-    auto sb = SB_Linear( graph );
-    if( !sb.run( sb_list ) ) {
-        //TODO error control
+    auto linear = []( const eadlib::WeightedGraph<size_t> &component,
+                      const size_t &thread_count,
+                      std::list<container::SuperBubble> &list ) {
+        return SB_Linear( component, thread_count ).run( list );
+    };
+    if( !runPerComponent( graph, linear, sb_list ) ) {
+        LOG_ERROR( "[sbp::algo::SB_Driver::runLinear( <graph>, <SuperBubble list> )] Superbubble detection failed on '", graph.getName(), "'." );
+        return false;
     }
     timer.mark( "end" );
     auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
     timer.outputToFile( writer, "Linear SuperBubble Algorithm" );
+    return true;
 }
 
 /**
  * Runs the O(m Log m) time superbubble identification algorithm
  * @param graph Graph to detect superbubble on
  * @param sb_list List to store SuperBubbles into
+ * @return Success
  */
-void sbp::algo::SB_Driver::runQLinear( const eadlib::WeightedGraph<size_t> &graph,
+bool sbp::algo::SB_Driver::runQLinear( const eadlib::WeightedGraph<size_t> &graph,
                                        std::list<sbp::algo::container::SuperBubble> &sb_list ) {
     auto timer  = sbp::chrono::Timer();
     timer.mark( "start" );
-    auto sb = SB_QLinear( graph );
-    if( !sb.run( sb_list ) ) {
-        //TODO error control
+    auto qlinear = []( const eadlib::WeightedGraph<size_t> &component,
+                       const size_t &thread_count,
+                       std::list<container::SuperBubble> &list ) {
+        return SB_QLinear( component, thread_count ).run( list );
+    };
+    if( !runPerComponent( graph, qlinear, sb_list ) ) {
+        LOG_ERROR( "[sbp::algo::SB_Driver::runQLinear( <graph>, <SuperBubble list> )] Superbubble detection failed on '", graph.getName(), "'." );
+        return false;
     }
     timer.mark( "end" );
     auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
     timer.outputToFile( writer, "Quasi-Linear SuperBubble Algorithm" );
+    return true;
+}
+
+/**
+ * Runs the O(m Log m) time superbubble identification algorithm resuming from/checkpointing its stages
+ * The graph is not split into its components here: each checkpoint holds one stage (SCCs, SubGraphs or
+ * DAGs) of the whole graph so that a run can be resumed from it. The stages still use all the threads.
+ * @param graph      Graph to detect superbubble on
+ * @param checkpoint Checkpoint store
+ * @param sb_list    List to store SuperBubbles into
+ * @return Success
+ */
+bool sbp::algo::SB_Driver::runQLinear( const eadlib::WeightedGraph<size_t> &graph,
+                                       const io::Checkpoint &checkpoint,
+                                       std::list<sbp::algo::container::SuperBubble> &sb_list ) {
+    auto timer  = sbp::chrono::Timer();
+    timer.mark( "start" );
+    auto sb = SB_QLinear( graph, checkpoint, _thread_count );
+    if( !sb.run( sb_list ) ) {
+        LOG_ERROR( "[sbp::algo::SB_Driver::runQLinear( <graph>, <checkpoint>, <SuperBubble list> )] Superbubble detection failed on '", graph.getName(), "'." );
+        return false;
+    }
+    timer.mark( "end" );
+    auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
+    timer.outputToFile( writer, "Quasi-Linear SuperBubble Algorithm (checkpointed)" );
+    return true;
+}
+
+/**
+ * Runs the O(m Log m) time dominator tree superbubble identification algorithm
+ * @param graph Graph to detect superbubble on
+ * @param sb_list List to store SuperBubbles into
+ * @return Success
+ */
+bool sbp::algo::SB_Driver::runDominators( const eadlib::WeightedGraph<size_t> &graph,
+                                          std::list<sbp::algo::container::SuperBubble> &sb_list ) {
+    auto timer  = sbp::chrono::Timer();
+    timer.mark( "start" );
+    auto dominators = []( const eadlib::WeightedGraph<size_t> &component,
+                          const size_t &thread_count,
+                          std::list<container::SuperBubble> &list ) {
+        return SB_Dominators( component, thread_count ).run( list );
+    };
+    if( !runPerComponent( graph, dominators, sb_list ) ) {
+        LOG_ERROR( "[sbp::algo::SB_Driver::runDominators( <graph>, <SuperBubble list> )] Superbubble detection failed on '", graph.getName(), "'." );
+        return false;
+    }
+    timer.mark( "end" );
+    auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
+    timer.outputToFile( writer, "Dominator SuperBubble Algorithm" );
+    return true;
+}
+
+/**
+ * Runs the O(n m) time superbubble identification algorithm
+ * @param graph   Graph to detect superbubbles on
+ * @param sb_list List to store SuperBubbles into
+ * @return Success
+ */
+bool sbp::algo::SB_Driver::runQuadratic( const eadlib::WeightedGraph<size_t> &graph,
+                                         std::list<container::SuperBubble> &sb_list ) {
+    auto timer  = sbp::chrono::Timer();
+    timer.mark( "start" );
+    auto quadratic = []( const eadlib::WeightedGraph<size_t> &component,
+                         const size_t &,
+                         std::list<container::SuperBubble> &list ) {
+        return SB_Quadratic( component ).run( list );
+    };
+    if( !runPerComponent( graph, quadratic, sb_list ) ) {
+        LOG_ERROR( "[sbp::algo::SB_Driver::runQuadratic( <graph>, <SuperBubble list> )] Superbubble detection failed on '", graph.getName(), "'." );
+        return false;
+    }
+    timer.mark( "end" );
+    auto writer = eadlib::io::FileWriter( "benchmarks.txt" );
+    timer.outputToFile( writer, "Quadratic SuperBubble Algorithm" );
+    return true;
+}
+
+/**
+ * Runs a superbubble algorithm on each weakly connected component of a graph concurrently
+ * (largest components first so that the threads finish at around the same time)
+ * @param graph     Graph to detect superbubbles on
+ * @param algorithm Superbubble algorithm to run on a component graph
+ * @param sb_list   List to store the SuperBubbles found into (with the graph's node IDs)
+ * @return Success on all components
+ */
+bool sbp::algo::SB_Driver::runPerComponent( const eadlib::WeightedGraph<size_t> &graph,
+                                            const Algorithm_t &algorithm,
+                                            std::list<container::SuperBubble> &sb_list ) {
+    auto components = WeakComponents( graph );
+    if( !components.findWCCs() ) {
+        LOG_ERROR( "[sbp::algo::SB_Driver::runPerComponent( <graph>, <algorithm>, <SuperBubble list> )] Could not find the graph's components." );
+        return false;
+    }
+    if( components.size() == 1 ) {
+        return algorithm( graph, _thread_count, sb_list );
+    }
+    std::vector<size_t> order( components.size() );
+    for( size_t i = 0; i < order.size(); i++ ) {
+        order[ i ] = i;
+    }
+    std::stable_sort( order.begin(), order.end(), [&]( const size_t &a, const size_t &b ) {
+        return components.getNodes( a ).size() > components.getNodes( b ).size();
+    } );
+    std::vector<std::list<container::SuperBubble>> results( components.size() );
+    std::atomic<size_t> next { 0 };
+    std::atomic<bool>   success { true };
+    //The thread budget is split between the component workers so the pools inside each algorithm don't oversubscribe
+    auto worker_count      = std::min( _thread_count, components.size() );
+    auto component_threads = std::max<size_t>( 1, _thread_count / worker_count );
+    std::vector<std::thread> workers;
+    for( size_t w = 0; w < worker_count; w++ ) {
+        workers.emplace_back( [&]() {
+            for( auto i = next.fetch_add( 1 ); i < order.size(); i = next.fetch_add( 1 ) ) {
+                auto component       = order[ i ];
+                auto component_graph = eadlib::WeightedGraph<size_t>( graph.getName() + "_" + std::to_string( component ) );
+                if( !components.extract( component, component_graph ) || !algorithm( component_graph, component_threads, results[ component ] ) ) {
+                    success = false;
+                }
+                const auto &nodes = components.getNodes( component );
+                for( auto &superbubble : results[ component ] ) { //local -> global IDs
+                    superbubble._in_id  = nodes[ superbubble._in_id ];
+                    superbubble._out_id = nodes[ superbubble._out_id ];
+                }
+            }
+        } );
+    }
+    for( auto &worker : workers ) {
+        worker.join();
+    }
+    for( auto &result : results ) {
+        sb_list.splice( sb_list.end(), result );
+    }
+    return success;
 }
@@ -1,7 +1,15 @@
 /**
     @class          sbp::algo::SB_Driver
     @brief          Driver for running superbubble algorithms
-    @dependencies   eadlib::WeightedGraph<T>, eadlib::io::FileWriter, sbp::algo::SB_Linear
+
+                    Unless checkpointed, the algorithms are run on each weakly connected
+                    component of the graph separately over a pool of threads and the
+                    SuperBubbles found are merged back under the graph's node IDs.
+                    The algorithms hold the (component) graph by reference so that each
+                    component only exists once as its extracted copy.
+
+    @dependencies   eadlib::WeightedGraph<T>, eadlib::io::FileWriter, sbp::algo::SB_Linear,
+                    sbp::algo::SB_QLinear, sbp::algo::SB_Dominators, sbp::algo::SB_Quadratic, sbp::algo::WeakComponents
     @author         E. A. Davison
     @copyright      E. A. Davison 2016
     @license        GNUv2 Public License
@@ -9,23 +17,40 @@
 #ifndef SUPERBUBBLE_PERFORMANCE_SB_DRIVER_H
 #define SUPERBUBBLE_PERFORMANCE_SB_DRIVER_H
 
+#include <atomic>
+#include <functional>
+#include <thread>
 #include <eadlib/io/FileWriter.h>
 #include <eadlib/datastructure/WeightedGraph.h>
 
 #include "../../chrono/Timer.h"
 #include "SB_Linear.h"
 #include "SB_QLinear.h"
+#include "SB_Dominators.h"
+#include "SB_Quadratic.h"
+#include "../WeakComponents.h"
 
 namespace sbp {
     namespace algo {
         class SB_Driver {
           public:
-            SB_Driver( eadlib::io::FileWriter &writer );
+            SB_Driver( eadlib::io::FileWriter &writer,
+                       const size_t &thread_count = std::thread::hardware_concurrency() );
             ~SB_Driver();
-            void runLinear( const eadlib::WeightedGraph<size_t> &graph, std::list<container::SuperBubble> &sb_list );
-            void runQLinear( const eadlib::WeightedGraph<size_t> &graph, std::list<container::SuperBubble> &sb_list );
+            bool runLinear( const eadlib::WeightedGraph<size_t> &graph, std::list<container::SuperBubble> &sb_list );
+            bool runQLinear( const eadlib::WeightedGraph<size_t> &graph, std::list<container::SuperBubble> &sb_list );
+            bool runQLinear( const eadlib::WeightedGraph<size_t> &graph,
+                             const io::Checkpoint &checkpoint,
+                             std::list<container::SuperBubble> &sb_list );
+            bool runDominators( const eadlib::WeightedGraph<size_t> &graph, std::list<container::SuperBubble> &sb_list );
+            bool runQuadratic( const eadlib::WeightedGraph<size_t> &graph, std::list<container::SuperBubble> &sb_list );
           private:
+            typedef std::function<bool( const eadlib::WeightedGraph<size_t> &, const size_t &, std::list<container::SuperBubble> & )> Algorithm_t;
+            bool runPerComponent( const eadlib::WeightedGraph<size_t> &graph,
+                                  const Algorithm_t &algorithm,
+                                  std::list<container::SuperBubble> &sb_list );
             eadlib::io::FileWriter &_writer;
+            size_t                  _thread_count;
         };
     }
 }
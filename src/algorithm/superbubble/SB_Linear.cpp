@@ -1,11 +1,15 @@
 #include "SB_Linear.h"
 
+constexpr size_t sbp::algo::SB_Linear::NONE;
+
 /**
  * Constructor
- * @param graph Graph on which to detect superbubbles
+ * @param graph        Graph on which to detect superbubbles
+ * @param thread_count Number of threads the SCC search, partitioning and DAG conversion may use
  */
-sbp::algo::SB_Linear::SB_Linear( const eadlib::WeightedGraph<size_t> &graph ) :
-    _graph( graph )
+sbp::algo::SB_Linear::SB_Linear( const eadlib::WeightedGraph<size_t> &graph, const size_t &thread_count ) :
+    _graph( graph ),
+    _thread_count( std::max<size_t>( 1, thread_count ) )
 {}
 
 /**
@@ -19,178 +23,142 @@ sbp::algo::SB_Linear::~SB_Linear() {}
  * @return Success
  */
 bool sbp::algo::SB_Linear::run( std::list<container::SuperBubble> &superbubble_list ) {
-    //Find SCCs
-    auto found_SCCs = Tarjan( _graph ).findSCCs();
-
-    //Partition graph into sub-graphs
-    auto sub_graphs = PartitionGraph().partitionSCCs( _graph, *found_SCCs, "SubGraph" );
-    found_SCCs.reset(); //no longer needed so early destruction to free up memory
-
-    //Convert SubGraphs into DAG
-    auto dag_packages = sbp::algo::GraphToDAG().convertToDAG( *sub_graphs, "DAG" );
-
-    for( auto it = dag_packages->begin(); it != dag_packages->end(); ++it ) {
-        std::vector<size_t> invOrd;
-        std::vector<size_t> ordD( it->_dag.nodeCount() );
-        fillTopologicalOrder( it->_dag, invOrd, ordD );
-
-        std::cout << "invOrd: ";
-        for( auto e : invOrd ) {
-            std::cout << e << " ";
-        }
-        std::cout << std::endl;
-
-        std::cout << "ordD: ";
-        for( auto e : ordD ) {
-            std::cout << e << " ";
-        }
-        std::cout << std::endl;
-
-        auto candidate_list = std::list<std::shared_ptr<sbp::algo::SB_Linear::Candidate>>();
-        auto pvsEntrance    = std::vector<std::shared_ptr<sbp::algo::SB_Linear::Candidate>>( it->_dag.nodeCount() );
-        generateCandidateList( it->_dag, invOrd, candidate_list, pvsEntrance );
+    size_t sg_count { 0 };
+    //Each SCC goes through partitioning, DAG conversion and detection as soon as it's found and is then freed
+    //(SubGraphs are viewed over the graph rather than copied out of it)
+    PartitionGraph partitioner( _thread_count );
+    auto process = [&]( const std::list<size_t> &scc, const bool &singletons ) {
+        auto id          = std::to_string( singletons ? 0 : ++sg_count );
+        auto sub_graph   = partitioner.view( _graph, scc, singletons, "SubGraph" + id );
+        auto dag_package = GraphToDAG( _thread_count ).convertImplicit( sub_graph->front(), "DAG" + id );
+        detect( *dag_package, sub_graph->front(), superbubble_list );
+    };
+    auto found = _graph.nodeCount() >= ParallelSCC::MIN_PARALLEL_NODES
+                 ? ParallelSCC( _graph, _thread_count ).findSCCs( process )
+                 : Tarjan( _graph ).findSCCs( process );
+    if( !found ) {
+        LOG_ERROR( "[sbp::algo::SB_Linear::run( <SuperBubble list> )] Could not find the SCCs of the graph." );
     }
-
-    //TODO
-    return 0;
+    return found;
 }
 
 /**
- * Fills a vector with the node IDs of a DAG in topological order
- * @param dag    DAG
- * @param invOrd Container for node IDs in topological order
- * @param ordD //TODO
+ * Prepare for constant time RMQ
+ * @param out_child      outChild indexed by topological order
+ * @param out_parent     outParent indexed by topological order
+ * @param rmq_out_child  Range maximum query structure to build over outChild
+ * @param rmq_out_parent Range minimum query structure to build over outParent
  */
-void sbp::algo::SB_Linear::fillTopologicalOrder( const sbp::graph::DAG &dag,
-                                                 std::vector<size_t> &invOrd,
-                                                 std::vector<size_t> &ordD ) {
-    auto order_stack = std::stack<size_t>();
-    auto visited     = std::vector<bool>( dag.nodeCount(), false );
-
-    topologicalSort( dag, dag.getSourceID(), visited, order_stack );
-
-    size_t order { 0 };
-    while( !order_stack.empty() ) {
-        invOrd.emplace_back( order_stack.top() );
-        ordD.at( order_stack.top() ) = order++;
-        order_stack.pop();
-    }
+void sbp::algo::SB_Linear::prepareForRMQ( const std::vector<size_t> &out_child,
+                                          const std::vector<size_t> &out_parent,
+                                          container::RangeMax &rmq_out_child,
+                                          container::RangeMin &rmq_out_parent ) {
+    rmq_out_child.build( out_child );
+    rmq_out_parent.build( out_parent );
 }
 
 /**
- * Sorts nodes in a DAG topologically
- * @param dag         DAG
- * @param v           Node (vertex)
- * @param visited     Visitation flags of nodes
- * @param order_stack Topological order stack
+ * Goes through the candidate list reporting the superbubbles found
+ * @param detection Detection state of the DAG
  */
-void sbp::algo::SB_Linear::topologicalSort( const sbp::graph::DAG &dag,
-                                            const size_t &v,
-                                            std::vector<bool> &visited,
-                                            std::stack<size_t> &order_stack ) {
-    visited.at( v ) = true;
-    auto node = dag.at( v );
-
-    for( auto child : node.childrenList ) {
-        if( !visited.at( child ) ) {
-            topologicalSort( dag, child, visited, order_stack );
+void sbp::algo::SB_Linear::reportSuperBubbles( Detection &detection ) {
+    auto &candidates = detection._candidates;
+    while( !candidates.empty() ) {
+        if( candidates.back()->_entrance_flag ) {
+            candidates.pop_back();
+        } else {
+            reportSuperBubble( detection, 0 );
         }
     }
-
-    order_stack.push( v );
 }
 
 /**
- * Generates candidate list
- * @param dag            DAG
- * @param invOrd         Container for node IDs in topological order
- * @param candidate_list Candidate list container
- * @param pvsEntrance    Previous entrances for each node ID
+ * Finds and reports the superbubble ending at the exit candidate at the tail of the list (if any)
+ * then the superbubbles nested in it (iterative: the nested superbubbles are looked for from the
+ * tail of the list back to their entrance)
+ * @param detection Detection state of the DAG
+ * @param start     Position of the candidate at which to stop looking for the entrance
  */
-void sbp::algo::SB_Linear::generateCandidateList( const sbp::graph::DAG &dag,
-                                                  const std::vector<size_t> &invOrd,
-                                                  std::list<std::shared_ptr<sbp::algo::SB_Linear::Candidate>> &candidate_list,
-                                                  std::vector<std::shared_ptr<sbp::algo::SB_Linear::Candidate>> &pvsEntrance ) {
-
-    std::shared_ptr<Candidate> pvs_entrance_ptr;
-    for( auto order : invOrd ) {
-        bool exit_flag { false };
-        bool entrance_flag { false };
-        auto node = dag.at( order );
-
-        //exit candidate
-        for( auto it = node.parentsList.begin(); it != node.parentsList.end() && !exit_flag; ++it ) {
-            if( dag.getOutDegree( *it ) == 1 ) {
-                candidate_list.emplace_back( std::make_shared<Candidate>( order, false, pvs_entrance_ptr ) );
-                exit_flag = true;
-            }
+void sbp::algo::SB_Linear::reportSuperBubble( Detection &detection,
+                                              const size_t &start ) {
+    auto &candidates = detection._candidates;
+    auto nested      = std::vector<size_t>(); //positions of the entrances of the superbubbles reported
+
+    /**
+     * [Lambda] Reports the superbubble ending at the exit at the tail of the list (if any) and removes the exit
+     */
+    auto report = [&]( const size_t &from ) {
+        auto exit = candidates.back();
+        auto s    = findEntrance( detection, from, *exit );
+        candidates.pop_back();
+        if( s != NONE ) {
+            detection._found.emplace_back( s, exit->_node_ID );
+            nested.emplace_back( detection._entrance_position[ s ] );
         }
-        //entrance candidate
-        for( auto it = node.childrenList.begin(); it != node.childrenList.end() && !entrance_flag; ++it ) {
-            if( dag.getInDegree( *it ) == 1 ) {
-                pvs_entrance_ptr = std::make_shared<Candidate>( order, true );
-                candidate_list.emplace_back( pvs_entrance_ptr );
-                entrance_flag = true;
-            }
+    };
+
+    report( start );
+    while( !nested.empty() ) {
+        if( candidates.size() <= nested.back() + 1 ) {
+            nested.pop_back();
+        } else if( candidates.back()->_entrance_flag ) {
+            candidates.pop_back();
+        } else {
+            report( nested.back() + 1 );
         }
-
-        pvsEntrance.at( order ) = pvs_entrance_ptr;
     }
 }
 
 /**
- * Generates outChild
- * @param dag       DAG
- * @param ordD      //TODO
- * @param out_child Container for outChildren
+ * Finds the entrance of the superbubble ending at an exit candidate
+ * @param detection Detection state of the DAG
+ * @param start     Position of the candidate at which to stop looking for the entrance
+ * @param exit      Exit candidate
+ * @return Entrance node ID or NONE
  */
-void sbp::algo::SB_Linear::generateOutChildren( const sbp::graph::DAG &dag,
-                                                const std::vector<size_t> &ordD,
-                                                std::vector<size_t> &out_child ) {
-
-    size_t max_order { 0 };
-    for( auto it = dag.begin(); it != dag.end(); ++it ) {
-        for( auto child : it->second.childrenList ) {
-            if( ordD.at( child ) >= max_order ) {
-                max_order = ordD.at( child );
-            }
-        }
-        out_child.at( ordD.at( it->first ) ) = max_order;
+size_t sbp::algo::SB_Linear::findEntrance( Detection &detection,
+                                           const size_t &start,
+                                           const Candidate &exit ) const {
+    const auto &ordD     = detection._ordD;
+    auto       min_order = ordD[ detection._candidates[ start ]->_node_ID ];
+    if( min_order >= ordD[ exit._node_ID ] ) {
+        return NONE;
     }
-}
-
-/**
- * Generates outParent
- * @param dag        DAG
- * @param ordD       //TODO
- * @param out_parent Container for outParents
- */
-void sbp::algo::SB_Linear::generateOutParents( const sbp::graph::DAG &dag,
-                                               const std::vector<size_t> &ordD,
-                                               std::vector<size_t> &out_parent ) {
-
-    size_t min_order { dag.nodeCount() };
-    for( auto it = dag.begin(); it != dag.end(); ++it ) {
-        for( auto parent : it->second.parentsList ) {
-            if( ordD.at( parent ) < min_order ) {
-                min_order = ordD.at( parent );
-            }
+    size_t s = exit._previous_entrance ? exit._previous_entrance->_node_ID : NONE;
+    while( s != NONE && ordD[ s ] >= min_order ) {
+        auto valid = validateSuperBubble( detection, s, exit._node_ID );
+        if( valid == s ) {
+            return s;
+        }
+        if( valid == NONE || valid == detection._alternative_entrance[ s ] ) {
+            break;
         }
-        out_parent.at( ordD.at( it->first ) ) = min_order;
+        detection._alternative_entrance[ s ] = valid;
+        s = valid;
     }
+    return NONE;
 }
 
 /**
- * Prepare for constant time RMQ
- * @param out_child
- * @param out_parent
- * @param rmq_out_child
- * @param rmq_out_parent
+ * Validates a superbubble candidate pair using the range queries over outChild/outParent
+ * @param detection    Detection state of the DAG
+ * @param start_vertex Entrance candidate
+ * @param end_vertex   Exit candidate
+ * @return start_vertex when valid, an alternative entrance to try or NONE when no superbubble ends at end_vertex
  */
-void sbp::algo::SB_Linear::prepareForRMQ( const std::vector<size_t> &out_child,
-                                          const std::vector<size_t> &out_parent,
-                                          std::vector<size_t> &rmq_out_child,
-                                          std::vector<size_t> &rmq_out_parent ) {
-    //TODO
+size_t sbp::algo::SB_Linear::validateSuperBubble( const Detection &detection,
+                                                  const size_t &start_vertex,
+                                                  const size_t &end_vertex ) const {
+    auto start      = detection._ordD[ start_vertex ];
+    auto end        = detection._ordD[ end_vertex ];
+    auto out_child  = detection._rmq_out_child.query( start, end - 1 );
+    auto out_parent = detection._rmq_out_parent.query( start + 1, end );
+    if( out_child != end || out_parent > start ) {
+        return NONE;
+    }
+    if( out_parent == start ) {
+        return start_vertex;
+    }
+    auto entrance = detection._pvsEntrance[ detection._invOrd[ out_parent ] ];
+    return entrance ? entrance->_node_ID : NONE;
 }
-
@@ -7,7 +7,8 @@
                     Theoretical Computer Science, 2015.
 
     @dependencies   eadlib::WeightedGraph<T>, eadlib::Graph<T>,
-                    sbp::algo::container::SuperBubble, sbp::algo::Tarjan, sbp::algo::GraphToDAG
+                    sbp::algo::container::SuperBubble, sbp::algo::container::SuperBubbleReporter, sbp::algo::container::RMQ, sbp::algo::Tarjan, sbp::algo::ParallelSCC, sbp::algo::GraphToDAG,
+                    sbp::graph::DAG/sbp::graph::ImplicitDAG
 
     @author         E. A. Davison
     @copyright      E. A. Davison 2016
@@ -18,12 +19,18 @@
 
 #include <vector>
 #include <memory>
+#include <stack>
+#include <limits>
+#include <algorithm>
 
 #include <eadlib/datastructure/Graph.h>
 #include <eadlib/datastructure/WeightedGraph.h>
 
 #include "container/SuperBubble.h"
+#include "container/RMQ.h"
+#include "container/SuperBubbleReporter.h"
 #include "../Tarjan.h"
+#include "../ParallelSCC.h"
 #include "../PartitionGraph.h"
 #include "../GraphToDAG.h"
 
@@ -31,7 +38,8 @@ namespace sbp {
     namespace algo {
         class SB_Linear {
           public:
-            SB_Linear( const eadlib::WeightedGraph<size_t> &graph );
+            SB_Linear( const eadlib::WeightedGraph<size_t> &graph,
+                       const size_t &thread_count = std::thread::hardware_concurrency() );
             ~SB_Linear();
             bool run( std::list<container::SuperBubble> &superbubble_list );
           //private:
@@ -50,35 +58,246 @@ namespace sbp {
                 std::shared_ptr<Candidate> _previous_entrance;
             };
 
-            void fillTopologicalOrder( const graph::DAG &dag,
-                                       std::vector<size_t> &invOrd,
-                                       std::vector<size_t> &ordD );
+            struct Detection {
+                Detection( const size_t &node_count ) :
+                    _ordD( node_count ),
+                    _pvsEntrance( node_count ),
+                    _entrance_position( node_count, NONE ),
+                    _alternative_entrance( node_count, NONE )
+                {}
+                std::vector<size_t>                     _invOrd;
+                std::vector<size_t>                     _ordD;
+                std::vector<std::shared_ptr<Candidate>> _candidates; //only ever removed from the tail
+                std::vector<std::shared_ptr<Candidate>> _pvsEntrance;
+                std::vector<size_t>                     _entrance_position; //position of each entrance in _candidates
+                std::vector<size_t>                     _alternative_entrance;
+                container::RangeMax                     _rmq_out_child;
+                container::RangeMin                     _rmq_out_parent;
+                std::vector<std::pair<size_t, size_t>>  _found; //(entrance, exit) local DAG IDs
+            };
+            static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+            template<class DAG_Package_t, class SubGraph_t> void detect( const DAG_Package_t &dag_package,
+                                                                         const SubGraph_t &sub_graph,
+                                                                         std::list<container::SuperBubble> &superbubble_list );
 
-            void topologicalSort( const graph::DAG &dag,
-                                  const size_t &v,
-                                  std::vector<bool> &visited,
-                                  std::stack<size_t> &order_stack );
+            template<class DAG_t> void fillTopologicalOrder( const DAG_t &dag,
+                                                             std::vector<size_t> &invOrd,
+                                                             std::vector<size_t> &ordD );
 
-            void generateCandidateList( const sbp::graph::DAG &dag,
-                                        const std::vector<size_t> &invOrd,
-                                        std::list<std::shared_ptr<Candidate>> &candidate_list,
-                                        std::vector<std::shared_ptr<Candidate>> &pvsEntrance );
+            template<class DAG_t> void topologicalSort( const DAG_t &dag,
+                                                        const size_t &v,
+                                                        std::vector<bool> &visited,
+                                                        std::stack<size_t> &order_stack );
 
-            void generateOutChildren( const graph::DAG &dag,
-                                      const std::vector<size_t> &ordD,
-                                      std::vector<size_t> &out_child );
+            template<class DAG_t> void generateCandidateList( const DAG_t &dag,
+                                                              const std::vector<size_t> &invOrd,
+                                                              std::vector<std::shared_ptr<Candidate>> &candidate_list,
+                                                              std::vector<std::shared_ptr<Candidate>> &pvsEntrance );
 
-            void generateOutParents( const graph::DAG &dag,
-                                     const std::vector<size_t> &ordD,
-                                     std::vector<size_t> &out_parent );
+            template<class DAG_t> void generateOutChildren( const DAG_t &dag,
+                                                            const std::vector<size_t> &invOrd,
+                                                            const std::vector<size_t> &ordD,
+                                                            std::vector<size_t> &out_child );
+
+            template<class DAG_t> void generateOutParents( const DAG_t &dag,
+                                                           const std::vector<size_t> &invOrd,
+                                                           const std::vector<size_t> &ordD,
+                                                           std::vector<size_t> &out_parent );
 
             void prepareForRMQ( const std::vector<size_t> &out_child,
                                 const std::vector<size_t> &out_parent,
-                                std::vector<size_t> &rmq_out_child,
-                                std::vector<size_t> &rmq_out_parent );
+                                container::RangeMax &rmq_out_child,
+                                container::RangeMin &rmq_out_parent );
+
+            void reportSuperBubbles( Detection &detection );
 
-            const eadlib::WeightedGraph<size_t> _graph;
+            void reportSuperBubble( Detection &detection,
+                                    const size_t &start );
+
+            size_t findEntrance( Detection &detection,
+                                 const size_t &start,
+                                 const Candidate &exit ) const;
+
+            size_t validateSuperBubble( const Detection &detection,
+                                        const size_t &start_vertex,
+                                        const size_t &end_vertex ) const;
+
+            const eadlib::WeightedGraph<size_t> &_graph;
+            size_t                              _thread_count;
         };
+
+        /**
+         * Detects the SuperBubbles in a DAG
+         * @param dag_package      DAG package of an SCC (explicit or implicit DAG)
+         * @param sub_graph        SubGraph the DAG was converted from (for the global IDs)
+         * @param superbubble_list SuperBubble list container to fill
+         */
+        template<class DAG_Package_t, class SubGraph_t> void SB_Linear::detect( const DAG_Package_t &dag_package,
+                                                                                const SubGraph_t &sub_graph,
+                                                                                std::list<container::SuperBubble> &superbubble_list ) {
+            const auto &dag = dag_package._dag;
+            if( dag.nodeCount() <= 2 ) {
+                return;
+            }
+            auto detection = Detection( dag.nodeCount() );
+            fillTopologicalOrder( dag, detection._invOrd, detection._ordD );
+            generateCandidateList( dag, detection._invOrd, detection._candidates, detection._pvsEntrance );
+            for( size_t i = 0; i < detection._candidates.size(); i++ ) {
+                if( detection._candidates[ i ]->_entrance_flag ) {
+                    detection._entrance_position[ detection._candidates[ i ]->_node_ID ] = i;
+                }
+            }
+            auto out_child  = std::vector<size_t>( detection._invOrd.size() );
+            auto out_parent = std::vector<size_t>( detection._invOrd.size() );
+            generateOutChildren( dag, detection._invOrd, detection._ordD, out_child );
+            generateOutParents( dag, detection._invOrd, detection._ordD, out_parent );
+            prepareForRMQ( out_child, out_parent, detection._rmq_out_child, detection._rmq_out_parent );
+            reportSuperBubbles( detection );
+            auto reporter = container::SuperBubbleReporter<decltype( dag_package._dag ), SubGraph_t>( dag, sub_graph, superbubble_list );
+            for( const auto &found : detection._found ) {
+                reporter.report( found.first, found.second );
+            }
+        }
+
+        /**
+         * Fills a vector with the node IDs of a DAG in topological order
+         * @param dag    DAG
+         * @param invOrd Container for node IDs in topological order
+         * @param ordD   Container for the topological order of each node ID (sized to the DAG's node count)
+         */
+        template<class DAG_t> void SB_Linear::fillTopologicalOrder( const DAG_t &dag,
+                                                                    std::vector<size_t> &invOrd,
+                                                                    std::vector<size_t> &ordD ) {
+            auto order_stack = std::stack<size_t>();
+            auto visited     = std::vector<bool>( dag.nodeCount(), false );
+
+            topologicalSort( dag, dag.getSourceID(), visited, order_stack );
+
+            size_t order { 0 };
+            while( !order_stack.empty() ) {
+                invOrd.emplace_back( order_stack.top() );
+                ordD.at( order_stack.top() ) = order++;
+                order_stack.pop();
+            }
+        }
+
+        /**
+         * Sorts nodes in a DAG topologically (iterative DFS)
+         * @param dag         DAG
+         * @param v           Node (vertex) to start from
+         * @param visited     Visitation flags of nodes
+         * @param order_stack Topological order stack
+         */
+        template<class DAG_t> void SB_Linear::topologicalSort( const DAG_t &dag,
+                                                               const size_t &v,
+                                                               std::vector<bool> &visited,
+                                                               std::stack<size_t> &order_stack ) {
+            auto call_stack = std::vector<std::pair<size_t, typename DAG_t::ChildCursor>>();
+            visited.at( v ) = true;
+            call_stack.emplace_back( v, dag.childCursor( v ) );
+            while( !call_stack.empty() ) {
+                size_t child { 0 };
+                if( dag.nextChild( call_stack.back().second, child ) ) {
+                    if( !visited.at( child ) ) {
+                        visited.at( child ) = true;
+                        call_stack.emplace_back( child, dag.childCursor( child ) );
+                    }
+                } else {
+                    order_stack.push( call_stack.back().first );
+                    call_stack.pop_back();
+                }
+            }
+        }
+
+        /**
+         * Generates candidate list
+         * @param dag            DAG
+         * @param invOrd         Container for node IDs in topological order
+         * @param candidate_list Candidate list container
+         * @param pvsEntrance    Previous entrances for each node ID
+         */
+        template<class DAG_t> void SB_Linear::generateCandidateList( const DAG_t &dag,
+                                                                     const std::vector<size_t> &invOrd,
+                                                                     std::vector<std::shared_ptr<SB_Linear::Candidate>> &candidate_list,
+                                                                     std::vector<std::shared_ptr<SB_Linear::Candidate>> &pvsEntrance ) {
+
+            std::shared_ptr<Candidate> pvs_entrance_ptr;
+            for( auto order : invOrd ) {
+                bool exit_flag { false };
+                bool entrance_flag { false };
+                auto node = dag.at( order );
+
+                //exit candidate
+                for( auto it = node.parentsList.begin(); it != node.parentsList.end() && !exit_flag; ++it ) {
+                    if( dag.getOutDegree( *it ) == 1 ) {
+                        candidate_list.emplace_back( std::make_shared<Candidate>( order, false, pvs_entrance_ptr ) );
+                        exit_flag = true;
+                    }
+                }
+                //entrance candidate
+                for( auto it = node.childrenList.begin(); it != node.childrenList.end() && !entrance_flag; ++it ) {
+                    if( dag.getInDegree( *it ) == 1 ) {
+                        pvs_entrance_ptr = std::make_shared<Candidate>( order, true );
+                        candidate_list.emplace_back( pvs_entrance_ptr );
+                        entrance_flag = true;
+                    }
+                }
+
+                pvsEntrance.at( order ) = pvs_entrance_ptr;
+            }
+        }
+
+        /**
+         * Generates outChild (highest topological order of the children of each node)
+         * Nodes with children missing from their copy in the DAG (edges to r' are only on the duplicates
+         * and back edges only on the originals) are given the same value as nodes without children:
+         * one past the last order so that no superbubble can go through them.
+         * @param dag       DAG
+         * @param invOrd    Node IDs in topological order
+         * @param ordD      Topological order of each node ID
+         * @param out_child Container for outChildren indexed by topological order
+         */
+        template<class DAG_t> void SB_Linear::generateOutChildren( const DAG_t &dag,
+                                                                   const std::vector<size_t> &invOrd,
+                                                                   const std::vector<size_t> &ordD,
+                                                                   std::vector<size_t> &out_child ) {
+            for( size_t order = 0; order < invOrd.size(); order++ ) {
+                auto   cursor = dag.childCursor( invOrd[ order ] );
+                size_t child { 0 };
+                size_t max_order { invOrd.size() };
+                if( !dag.hasMissingChildren( invOrd[ order ] ) && dag.nextChild( cursor, child ) ) {
+                    max_order = ordD.at( child );
+                    while( dag.nextChild( cursor, child ) ) {
+                        max_order = std::max( max_order, ordD.at( child ) );
+                    }
+                }
+                out_child.at( order ) = max_order;
+            }
+        }
+
+        /**
+         * Generates outParent (lowest topological order of the parents of each node)
+         * Nodes with parents missing from their copy in the DAG (edges from r are only on the originals
+         * and back edges only reach the duplicates) are given the same value as nodes without parents: 0 (r).
+         * @param dag        DAG
+         * @param invOrd     Node IDs in topological order
+         * @param ordD       Topological order of each node ID
+         * @param out_parent Container for outParents indexed by topological order
+         */
+        template<class DAG_t> void SB_Linear::generateOutParents( const DAG_t &dag,
+                                                                  const std::vector<size_t> &invOrd,
+                                                                  const std::vector<size_t> &ordD,
+                                                                  std::vector<size_t> &out_parent ) {
+            for( size_t order = 0; order < invOrd.size(); order++ ) {
+                auto   node = dag.at( invOrd[ order ] );
+                size_t min_order { node.parentsList.empty() || dag.hasMissingParents( invOrd[ order ] ) ? 0 : invOrd.size() };
+                for( auto parent : node.parentsList ) {
+                    min_order = std::min( min_order, ordD.at( parent ) );
+                }
+                out_parent.at( order ) = min_order;
+            }
+        }
     }
 }
 
@@ -1,12 +1,28 @@
 #include "SB_QLinear.h"
-#include "../../graph/SubGraph.h"
 
 /**
  * Constructor
- * @param graph Graph on which to detect superbubbles
+ * @param graph        Graph on which to detect superbubbles
+ * @param thread_count Number of threads the SCC search, partitioning and DAG conversion may use
  */
-sbp::algo::SB_QLinear::SB_QLinear( const eadlib::WeightedGraph<size_t> &graph ) :
-    _graph( graph )
+sbp::algo::SB_QLinear::SB_QLinear( const eadlib::WeightedGraph<size_t> &graph, const size_t &thread_count ) :
+    _graph( graph ),
+    _checkpoint( nullptr ),
+    _thread_count( std::max<size_t>( 1, thread_count ) )
+{}
+
+/**
+ * Constructor
+ * @param graph        Graph on which to detect superbubbles
+ * @param checkpoint   Checkpoint store to resume from and save each stage's result into
+ * @param thread_count Number of threads the SCC search, partitioning and DAG conversion may use
+ */
+sbp::algo::SB_QLinear::SB_QLinear( const eadlib::WeightedGraph<size_t> &graph,
+                                   const io::Checkpoint &checkpoint,
+                                   const size_t &thread_count ) :
+    _graph( graph ),
+    _checkpoint( &checkpoint ),
+    _thread_count( std::max<size_t>( 1, thread_count ) )
 {}
 
 /**
@@ -20,15 +36,112 @@ sbp::algo::SB_QLinear::~SB_QLinear() {}
  * @return Success
  */
 bool sbp::algo::SB_QLinear::run( std::list<sbp::algo::container::SuperBubble> &superbubble_list ) {
-    //Find SCCs
-    auto found_SCCs = Tarjan( _graph ).findSCCs();
+    if( _checkpoint ) { //each stage is kept whole so that it can be checkpointed
+        auto sub_graphs   = std::unique_ptr<PartitionGraph::SubGraphList_t>();
+        auto dag_packages = resume( sub_graphs );
+        if( !dag_packages ) {
+            LOG_ERROR( "[sbp::algo::SB_QLinear::run( <SuperBubble list> )] Could not resume/compute the DAGs of the graph." );
+            return false;
+        }
+        auto sub_graph    = sub_graphs->begin();
+        for( const auto &dag_package : *dag_packages ) {
+            detect( dag_package, *sub_graph++, superbubble_list );
+        }
+        return true;
+    }
+    size_t sg_count { 0 };
+    //Each SCC goes through partitioning, DAG conversion and detection as soon as it's found and is then freed
+    //(SubGraphs are viewed over the graph rather than copied out of it)
+    PartitionGraph partitioner( _thread_count );
+    auto process = [&]( const std::list<size_t> &scc, const bool &singletons ) {
+        auto id          = std::to_string( singletons ? 0 : ++sg_count );
+        auto sub_graph   = partitioner.view( _graph, scc, singletons, "SubGraph" + id );
+        auto dag_package = GraphToDAG( _thread_count ).convert( sub_graph->front(), "DAG" + id );
+        detect( dag_package->front(), sub_graph->front(), superbubble_list );
+    };
+    auto found = _graph.nodeCount() >= ParallelSCC::MIN_PARALLEL_NODES
+                 ? ParallelSCC( _graph, _thread_count ).findSCCs( process )
+                 : Tarjan( _graph ).findSCCs( process );
+    if( !found ) {
+        LOG_ERROR( "[sbp::algo::SB_QLinear::run( <SuperBubble list> )] Could not find the SCCs of the graph." );
+    }
+    return found;
+}
 
-    //Partition graph into sub-graphs
-    auto sub_graphs = PartitionGraph().partitionSCCs( _graph, *found_SCCs, "SubGraph" );
-    found_SCCs.reset(); //no longer needed so early destruction to free up memory
+/**
+ * Merges the nodes left waiting by a failed search into the current search
+ * (the smaller set is merged into the larger one)
+ * @param from      Nodes left waiting by the failed search (emptied)
+ * @param detection Detection data
+ * @param seen      Nodes seen in the current search but not yet visitable
+ * @param visitable Nodes visitable in the current search
+ */
+void sbp::algo::SB_QLinear::merge( Seen_t &from,
+                                   Detection &detection,
+                                   Seen_t &seen,
+                                   std::stack<size_t> &visitable ) const {
+    if( from.size() > seen.size() ) {
+        std::swap( from, seen );
+    }
+    for( const auto &node : from ) {
+        auto &count = seen[ node.first ];
+        count += node.second;
+        if( count == detection._in_degree[ node.first ] ) {
+            seen.erase( node.first );
+            visitable.push( node.first );
+        }
+    }
+    from.clear();
+}
 
+/**
+ * Gets the DAG packages of the graph's SCCs and the SubGraphs they were converted from
+ * starting from the latest valid checkpoint if any (each stage computed is checkpointed)
+ * The DAGs are only resumed from alongside their SubGraphs as these are needed for the global IDs.
+ * @param sub_graphs Container for the SubGraph list (in the same order as the DAG packages)
+ * @return DAG package list (nullptr on failure)
+ */
+std::unique_ptr<sbp::algo::GraphToDAG::DAG_List_t> sbp::algo::SB_QLinear::resume( std::unique_ptr<PartitionGraph::SubGraphList_t> &sub_graphs ) {
+    sub_graphs = std::make_unique<PartitionGraph::SubGraphList_t>();
+    if( _checkpoint && _checkpoint->load( *sub_graphs ) ) {
+        auto dag_packages = std::make_unique<GraphToDAG::DAG_List_t>();
+        if( _checkpoint->load( *dag_packages ) && dag_packages->size() == sub_graphs->size() ) {
+            std::cout << "-> Checkpoint: resuming from the DAGs." << std::endl;
+            return dag_packages;
+        }
+        std::cout << "-> Checkpoint: resuming from the SubGraphs." << std::endl;
+    } else {
+        //Find SCCs
+        auto found_SCCs = std::make_unique<std::list<std::list<size_t>>>();
+        if( _checkpoint && _checkpoint->load( *found_SCCs ) ) {
+            std::cout << "-> Checkpoint: resuming from the SCCs." << std::endl;
+        } else {
+            found_SCCs = _graph.nodeCount() >= ParallelSCC::MIN_PARALLEL_NODES
+                         ? ParallelSCC( _graph, _thread_count ).findSCCs()
+                         : Tarjan( _graph ).findSCCs();
+            if( found_SCCs->empty() ) { //the singleton list is always there on success
+                LOG_ERROR( "[sbp::algo::SB_QLinear::resume( <SubGraph list> )] Could not find the SCCs of the graph." );
+                return nullptr;
+            }
+            if( _checkpoint ) {
+                _checkpoint->save( *found_SCCs );
+            }
+        }
+        //Partition graph into sub-graphs
+        sub_graphs = PartitionGraph( _thread_count ).partitionSCCs( _graph, *found_SCCs, "SubGraph" );
+        found_SCCs.reset(); //no longer needed so early destruction to free up memory
+        if( _checkpoint ) {
+            _checkpoint->save( *sub_graphs );
+        }
+    }
     //Convert SubGraphs into DAG
-    auto dag_packages = sbp::algo::GraphToDAG().convertToDAG( *sub_graphs, "DAG" );
-
-    return false;
+    auto dag_packages = sbp::algo::GraphToDAG( _thread_count ).convertToDAG( *sub_graphs, "DAG" );
+    if( !dag_packages || dag_packages->size() != sub_graphs->size() ) {
+        LOG_ERROR( "[sbp::algo::SB_QLinear::resume( <SubGraph list> )] Could not convert the SubGraphs into DAGs." );
+        return nullptr;
+    }
+    if( _checkpoint ) {
+        _checkpoint->save( *dag_packages );
+    }
+    return dag_packages;
 }
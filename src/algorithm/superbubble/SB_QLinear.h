@@ -6,8 +6,15 @@
                     by Wing-Kin Sung, Kunihiko Sadakane, Tetsuo Shibuya, Abha Belorkar, and Iana Pyrogova,
                     IEEE/ACM Transactions on Computational Biology and Bioinformatics, Vol. 12, No. 4, July/August 2015
 
+                    Each node of a DAG is tried as an entrance in reverse topological order with the
+                    search of the quadratic algorithm (a node is visited once all its parents have been).
+                    A search that reaches a node already tried as an entrance reuses its result instead of
+                    going through its descendants again: the exit found from it is visited next, or the nodes
+                    its search left waiting on other parents are merged in (the smaller set into the larger).
+
     @dependencies   eadlib::WeightedGraph<T>, eadlib::Graph<T>,
-                    sbp::algo::container::SuperBubble, sbp::algo::Tarjan, sbp::algo::GraphToDAG
+                    sbp::algo::container::SuperBubble, sbp::algo::container::SuperBubbleReporter, sbp::algo::Tarjan, sbp::algo::ParallelSCC, sbp::algo::GraphToDAG,
+                    sbp::io::Checkpoint
 
     @author         E. A. Davison
     @copyright      E. A. Davison 2016
@@ -19,25 +26,231 @@
 
 #include <vector>
 #include <memory>
+#include <stack>
+#include <limits>
+#include <unordered_map>
 
 #include <eadlib/datastructure/Graph.h>
 #include <eadlib/datastructure/WeightedGraph.h>
 
 #include "container/SuperBubble.h"
+#include "container/SuperBubbleReporter.h"
 #include "../Tarjan.h"
+#include "../ParallelSCC.h"
 #include "../PartitionGraph.h"
 #include "../GraphToDAG.h"
+#include "../../io/Checkpoint.h"
 
 namespace sbp {
     namespace algo {
         class SB_QLinear {
           public:
-            SB_QLinear( const eadlib::WeightedGraph<size_t> &graph );
+            SB_QLinear( const eadlib::WeightedGraph<size_t> &graph,
+                        const size_t &thread_count = std::thread::hardware_concurrency() );
+            SB_QLinear( const eadlib::WeightedGraph<size_t> &graph,
+                        const io::Checkpoint &checkpoint,
+                        const size_t &thread_count = std::thread::hardware_concurrency() );
             ~SB_QLinear();
             bool run( std::list<container::SuperBubble> &superbubble_list );
           private:
-            const eadlib::WeightedGraph<size_t> _graph;
+            typedef std::unordered_map<size_t, size_t> Seen_t; //node ID -> number of parents visited
+
+            struct Detection {
+                Detection( const size_t &node_count ) :
+                    _in_degree( node_count, 0 ),
+                    _exit( node_count, NONE ),
+                    _seen( node_count )
+                {}
+                std::vector<size_t> _in_degree; //with the links to r/r' of nodes missing a parent/child
+                std::vector<size_t> _exit;      //exit found from each entrance tried
+                std::vector<Seen_t> _seen;      //nodes left waiting by each failed search
+            };
+            static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+            std::unique_ptr<GraphToDAG::DAG_List_t> resume( std::unique_ptr<PartitionGraph::SubGraphList_t> &sub_graphs );
+
+            template<class DAG_Package_t, class SubGraph_t> void detect( const DAG_Package_t &dag_package,
+                                                                         const SubGraph_t &sub_graph,
+                                                                         std::list<container::SuperBubble> &superbubble_list );
+
+            template<class DAG_t> void fillTopologicalOrder( const DAG_t &dag,
+                                                             std::vector<size_t> &order ) const;
+
+            template<class DAG_t> void fillInDegrees( const DAG_t &dag,
+                                                      Detection &detection ) const;
+
+            template<class DAG_t> void visitChildren( const DAG_t &dag,
+                                                      const size_t &node,
+                                                      Detection &detection,
+                                                      Seen_t &seen,
+                                                      std::stack<size_t> &visitable ) const;
+
+            template<class DAG_t> void findExit( const DAG_t &dag,
+                                                 const size_t &entrance,
+                                                 Detection &detection ) const;
+
+            void merge( Seen_t &from,
+                        Detection &detection,
+                        Seen_t &seen,
+                        std::stack<size_t> &visitable ) const;
+
+            const eadlib::WeightedGraph<size_t> &_graph;
+            const io::Checkpoint *_checkpoint; //optional
+            size_t                _thread_count;
         };
+
+        /**
+         * Detects the SuperBubbles in a DAG
+         * @param dag_package      DAG package of an SCC (explicit or implicit DAG)
+         * @param sub_graph        SubGraph the DAG was converted from (for the global IDs)
+         * @param superbubble_list SuperBubble list container to fill
+         */
+        template<class DAG_Package_t, class SubGraph_t> void SB_QLinear::detect( const DAG_Package_t &dag_package,
+                                                                                 const SubGraph_t &sub_graph,
+                                                                                 std::list<container::SuperBubble> &superbubble_list ) {
+            const auto &dag = dag_package._dag;
+            if( dag.nodeCount() <= 2 ) {
+                return;
+            }
+            auto order = std::vector<size_t>();
+            fillTopologicalOrder( dag, order );
+            auto detection = Detection( dag.nodeCount() );
+            fillInDegrees( dag, detection );
+            //Descendants first so that their searches can be reused
+            for( auto it = order.rbegin(); it != order.rend(); ++it ) {
+                if( *it != dag.getSourceID() && *it != dag.getTerminalID() ) {
+                    findExit( dag, *it, detection );
+                }
+            }
+            auto reporter = container::SuperBubbleReporter<decltype( dag_package._dag ), SubGraph_t>( dag, sub_graph, superbubble_list );
+            for( auto s : order ) {
+                if( detection._exit[ s ] != NONE ) {
+                    reporter.report( s, detection._exit[ s ] );
+                }
+            }
+        }
+
+        /**
+         * Fills a vector with the node IDs of a DAG in topological order (r first and r' last)
+         * @param dag   DAG
+         * @param order Container for node IDs in topological order
+         */
+        template<class DAG_t> void SB_QLinear::fillTopologicalOrder( const DAG_t &dag,
+                                                                     std::vector<size_t> &order ) const {
+            auto in_degree = std::vector<size_t>( dag.nodeCount() );
+            order.reserve( dag.nodeCount() );
+            order.emplace_back( dag.getSourceID() );
+            for( size_t node = 0; node < dag.nodeCount(); node++ ) {
+                if( node != dag.getSourceID() && node != dag.getTerminalID() ) {
+                    in_degree[ node ] = dag.getInDegree( node );
+                    if( in_degree[ node ] == 0 ) {
+                        order.emplace_back( node );
+                    }
+                }
+            }
+            for( size_t i = 0; i < order.size(); i++ ) {
+                auto   cursor = dag.childCursor( order[ i ] );
+                size_t child { 0 };
+                while( dag.nextChild( cursor, child ) ) {
+                    if( child != dag.getTerminalID() && --in_degree[ child ] == 0 ) {
+                        order.emplace_back( child );
+                    }
+                }
+            }
+            order.emplace_back( dag.getTerminalID() );
+        }
+
+        /**
+         * Counts the parents of each node of a DAG as seen by the searches
+         * A node missing a parent in its copy gets one more that is never visited (r) and
+         * a node missing a child or without any is counted as a parent of r' once.
+         * @param dag       DAG
+         * @param detection Detection data
+         */
+        template<class DAG_t> void SB_QLinear::fillInDegrees( const DAG_t &dag,
+                                                              Detection &detection ) const {
+            for( size_t node = 0; node < dag.nodeCount(); node++ ) {
+                if( node == dag.getTerminalID() ) {
+                    continue;
+                }
+                detection._in_degree[ node ] += dag.getInDegree( node ) + ( dag.hasMissingParents( node ) ? 1 : 0 );
+                auto   cursor = dag.childCursor( node );
+                size_t child { 0 };
+                bool   has_children { false };
+                bool   has_terminal { false };
+                while( dag.nextChild( cursor, child ) ) {
+                    has_children = true;
+                    has_terminal |= child == dag.getTerminalID();
+                }
+                if( has_terminal || ( node != dag.getSourceID() && ( !has_children || dag.hasMissingChildren( node ) ) ) ) {
+                    detection._in_degree[ dag.getTerminalID() ]++;
+                }
+            }
+        }
+
+        /**
+         * Visits the children of a node in a search (a child whose parents have all been visited becomes visitable)
+         * @param dag       DAG
+         * @param node      Node ID
+         * @param detection Detection data
+         * @param seen      Nodes seen in the search but not yet visitable
+         * @param visitable Nodes visitable in the search
+         */
+        template<class DAG_t> void SB_QLinear::visitChildren( const DAG_t &dag,
+                                                              const size_t &node,
+                                                              Detection &detection,
+                                                              Seen_t &seen,
+                                                              std::stack<size_t> &visitable ) const {
+            auto   cursor = dag.childCursor( node );
+            size_t child { 0 };
+            bool   has_children { false };
+            bool   has_terminal { false };
+            auto   visit = [&]( const size_t &id ) {
+                if( ++seen[ id ] == detection._in_degree[ id ] ) {
+                    seen.erase( id );
+                    visitable.push( id );
+                }
+            };
+            while( dag.nextChild( cursor, child ) ) {
+                has_children = true;
+                has_terminal |= child == dag.getTerminalID();
+                visit( child );
+            }
+            if( !has_terminal && ( !has_children || dag.hasMissingChildren( node ) ) ) {
+                visit( dag.getTerminalID() );
+            }
+        }
+
+        /**
+         * Searches for the exit of an entrance candidate
+         * The nodes visitable from it that were already tried as entrances (all its descendants) are not
+         * searched through again: the exit found from them is made visitable or, when their search failed,
+         * the nodes it left waiting are merged into this search's.
+         * @param dag       DAG
+         * @param entrance  Node ID of the entrance candidate
+         * @param detection Detection data (exit and waiting nodes of the entrance are set)
+         */
+        template<class DAG_t> void SB_QLinear::findExit( const DAG_t &dag,
+                                                         const size_t &entrance,
+                                                         Detection &detection ) const {
+            auto seen      = Seen_t();
+            auto visitable = std::stack<size_t>();
+            visitChildren( dag, entrance, detection, seen, visitable );
+            while( !visitable.empty() ) {
+                if( visitable.size() == 1 && seen.empty() ) {
+                    detection._exit[ entrance ] = visitable.top();
+                    return;
+                }
+                auto node = visitable.top();
+                visitable.pop();
+                if( detection._exit[ node ] != NONE ) {
+                    visitable.push( detection._exit[ node ] );
+                } else {
+                    merge( detection._seen[ node ], detection, seen, visitable );
+                }
+            }
+            detection._seen[ entrance ] = std::move( seen );
+        }
     }
 }
 
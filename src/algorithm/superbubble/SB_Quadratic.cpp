@@ -0,0 +1,91 @@
+#include "SB_Quadratic.h"
+
+constexpr size_t sbp::algo::SB_Quadratic::NONE;
+
+/**
+ * Constructor
+ * @param graph Graph on which to detect superbubbles
+ */
+sbp::algo::SB_Quadratic::SB_Quadratic( const eadlib::WeightedGraph<size_t> &graph ) :
+    _graph( graph )
+{}
+
+/**
+ * Destructor
+ */
+sbp::algo::SB_Quadratic::~SB_Quadratic() {}
+
+/**
+ * Runs the Quadratic SuperBubble identification algorithm
+ * @param superbubble_list SuperBubble list container to fill
+ * @return Success
+ */
+bool sbp::algo::SB_Quadratic::run( std::list<container::SuperBubble> &superbubble_list ) {
+    if( _graph.isEmpty() ) {
+        LOG_ERROR( "[sbp::algo::SB_Quadratic::run( <SuperBubble list> )] Graph is empty." );
+        return false;
+    }
+    size_t id_bound { 0 };
+    for( const auto &node : _graph ) {
+        id_bound = std::max( id_bound, node.first + 1 );
+    }
+    auto search = Search( id_bound );
+    for( const auto &node : _graph ) {
+        auto t = findExit( node.first, search );
+        if( t != NONE ) {
+            superbubble_list.emplace_back( container::SuperBubble( { node.first, t } ) );
+        }
+    }
+    return true;
+}
+
+/**
+ * Finds the exit of the superbubble with a given entrance (O(m))
+ * @param s      Node ID of the entrance
+ * @param search Search state (reset on return)
+ * @return Node ID of the exit or NONE when s is not the entrance of a superbubble
+ */
+size_t sbp::algo::SB_Quadratic::findExit( const size_t &s, Search &search ) const {
+    auto   &stack = search._stack;
+    size_t seen_count { 0 };
+    size_t exit { NONE };
+    bool   done { false };
+    stack.emplace_back( s );
+    while( !stack.empty() && !done ) {
+        auto v = stack.back();
+        stack.pop_back();
+        if( search._seen[ v ] ) { //now visited
+            search._seen[ v ] = false;
+            seen_count--;
+        }
+        const auto &children = _graph.at( v ).childrenList;
+        done = children.empty(); //tip
+        for( auto it = children.begin(); it != children.end() && !done; ++it ) {
+            if( *it == s ) { //cycle through s
+                done = true;
+            } else {
+                if( search._visited_parents[ *it ]++ == 0 ) { //first seen
+                    search._touched.emplace_back( *it );
+                    search._seen[ *it ] = true;
+                    seen_count++;
+                }
+                if( search._visited_parents[ *it ] == _graph.at( *it ).parentsList.size() ) {
+                    stack.emplace_back( *it );
+                }
+            }
+        }
+        if( !done && stack.size() == 1 && seen_count == 1 ) { //the only node seen is next to be visited
+            if( !_graph.edgeExists( stack.back(), s ) ) {
+                exit = stack.back();
+            }
+            done = true;
+        }
+    }
+    for( auto u : search._touched ) {
+        search._visited_parents[ u ] = 0;
+        search._seen[ u ]            = false;
+    }
+    search._touched.clear();
+    stack.clear();
+    return exit;
+}
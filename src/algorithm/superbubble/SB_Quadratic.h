@@ -0,0 +1,55 @@
+/**
+    @class          sbp::algo::SB_Quadratic
+    @brief          Implementation of the O(n m) superbubble algorithm
+
+                    Based on: "Detecting Superbubbles in Assembly Graphs"
+                    by T. Onodera, K. Sadakane, T. Shibuya,
+                    Algorithms in Bioinformatics (WABI 2013), LNCS 8126, pp. 338-348.
+
+                    Each node is tried as the entrance s of a superbubble with a search visiting a node
+                    once all its parents have been visited. The search fails on a tip or on an edge back
+                    to s and stops at the exit t when it is the only node seen but not yet visited.
+                    Works directly on the graph (no SCC partitioning nor DAG conversion) so it serves as
+                    the reference for the other algorithms.
+
+    @dependencies   eadlib::WeightedGraph<T>, sbp::algo::container::SuperBubble
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_SB_QUADRATIC_H
+#define SUPERBUBBLE_PERFORMANCE_SB_QUADRATIC_H
+
+#include <list>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#include <eadlib/logger/Logger.h>
+#include <eadlib/datastructure/WeightedGraph.h>
+
+#include "container/SuperBubble.h"
+
+namespace sbp {
+    namespace algo {
+        class SB_Quadratic {
+          public:
+            SB_Quadratic( const eadlib::WeightedGraph<size_t> &graph );
+            ~SB_Quadratic();
+            bool run( std::list<container::SuperBubble> &superbubble_list );
+          private:
+            struct Search {
+                Search( const size_t &id_bound ) :
+                    _visited_parents( id_bound, 0 ),
+                    _seen( id_bound, false )
+                {}
+                std::vector<size_t> _visited_parents; //number of parents visited of each node
+                std::vector<bool>   _seen;            //seen (child of a visited node) but not yet visited
+                std::vector<size_t> _touched;         //nodes to reset before the next search
+                std::vector<size_t> _stack;           //nodes with all their parents visited
+            };
+            static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+            size_t findExit( const size_t &s, Search &search ) const;
+            const eadlib::WeightedGraph<size_t> &_graph;
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_SB_QUADRATIC_H
@@ -0,0 +1,175 @@
+/**
+    @class          sbp::algo::container::RMQ
+    @brief          Constant time range minimum/maximum query
+
+    Built in linear time over a copy of the values. The values are split into blocks of 64:
+    queries inside a block use a bit mask per position (the positions left on a monotonic stack
+    of the block after that position) and queries spanning blocks combine the two partial blocks
+    with a sparse table over the blocks' best values ((n/64) log (n/64) entries).
+    The Compare type decides which value is 'best' (std::less: minimum, std::greater: maximum).
+
+    @dependencies   eadlib::logger::Logger
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_RMQ_H
+#define SUPERBUBBLE_PERFORMANCE_RMQ_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+#include <eadlib/logger/Logger.h>
+
+namespace sbp {
+    namespace algo {
+        namespace container {
+            template<class Compare> class RMQ {
+              public:
+                RMQ();
+                RMQ( const std::vector<size_t> &values );
+                ~RMQ();
+                void build( const std::vector<size_t> &values );
+                size_t query( const size_t &from, const size_t &to ) const;
+                size_t size() const;
+              private:
+                static constexpr size_t BLOCK_SIZE = 64;
+                size_t best( const size_t &a, const size_t &b ) const;
+                size_t queryBlock( const size_t &from, const size_t &to ) const;
+                static size_t log2( const uint64_t &x );
+                Compare                          _compare;
+                std::vector<size_t>              _values;
+                std::vector<uint64_t>            _masks;  //in-block stack state after each position
+                std::vector<std::vector<size_t>> _sparse; //best of 2^k blocks from each block
+            };
+
+            typedef RMQ<std::less<size_t>>    RangeMin;
+            typedef RMQ<std::greater<size_t>> RangeMax;
+
+            template<class Compare> constexpr size_t RMQ<Compare>::BLOCK_SIZE;
+
+            /**
+             * Constructor (empty)
+             */
+            template<class Compare> RMQ<Compare>::RMQ() {}
+
+            /**
+             * Constructor
+             * @param values Values to query
+             */
+            template<class Compare> RMQ<Compare>::RMQ( const std::vector<size_t> &values ) {
+                build( values );
+            }
+
+            /**
+             * Destructor
+             */
+            template<class Compare> RMQ<Compare>::~RMQ() {}
+
+            /**
+             * Builds the query structures (O(n))
+             * @param values Values to query
+             */
+            template<class Compare> void RMQ<Compare>::build( const std::vector<size_t> &values ) {
+                _values = values;
+                _masks  = std::vector<uint64_t>( _values.size() );
+                _sparse.clear();
+                auto block_count = ( _values.size() + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+                auto block_best  = std::vector<size_t>( block_count );
+                for( size_t block = 0; block < block_count; block++ ) {
+                    auto first = block * BLOCK_SIZE;
+                    auto last  = std::min( first + BLOCK_SIZE, _values.size() );
+                    uint64_t stack { 0 };
+                    for( auto i = first; i < last; i++ ) {
+                        while( stack && _compare( _values[ i ], _values[ first + log2( stack ) ] ) ) {
+                            stack &= ~( uint64_t( 1 ) << log2( stack ) );
+                        }
+                        stack |= uint64_t( 1 ) << ( i - first );
+                        _masks[ i ] = stack;
+                    }
+                    block_best[ block ] = queryBlock( first, last - 1 );
+                }
+                if( block_count == 0 ) {
+                    return;
+                }
+                _sparse.emplace_back( std::move( block_best ) );
+                for( size_t k = 1; ( size_t( 1 ) << k ) <= block_count; k++ ) {
+                    const auto &previous = _sparse.back();
+                    auto level = std::vector<size_t>( block_count - ( size_t( 1 ) << k ) + 1 );
+                    for( size_t block = 0; block < level.size(); block++ ) {
+                        level[ block ] = best( previous[ block ], previous[ block + ( size_t( 1 ) << ( k - 1 ) ) ] );
+                    }
+                    _sparse.emplace_back( std::move( level ) );
+                }
+            }
+
+            /**
+             * Gets the best value in a range (O(1))
+             * @param from First position of the range
+             * @param to   Last position of the range (inclusive)
+             * @return Best value
+             * @throws std::out_of_range when the range is empty or goes past the values
+             */
+            template<class Compare> size_t RMQ<Compare>::query( const size_t &from, const size_t &to ) const {
+                if( from > to || to >= _values.size() ) {
+                    LOG_ERROR( "[sbp::algo::container::RMQ::query( ", from, ", ", to, " )] Invalid range (size: ", _values.size(), ")." );
+                    throw std::out_of_range( "Range is not within the values." );
+                }
+                auto from_block = from / BLOCK_SIZE;
+                auto to_block   = to / BLOCK_SIZE;
+                if( from_block == to_block ) {
+                    return queryBlock( from, to );
+                }
+                auto value = best( queryBlock( from, from_block * BLOCK_SIZE + BLOCK_SIZE - 1 ),
+                                   queryBlock( to_block * BLOCK_SIZE, to ) );
+                if( to_block - from_block > 1 ) {
+                    auto first = from_block + 1;
+                    auto k     = log2( to_block - first );
+                    value = best( value, best( _sparse[ k ][ first ], _sparse[ k ][ to_block - ( size_t( 1 ) << k ) ] ) );
+                }
+                return value;
+            }
+
+            /**
+             * Gets the number of values
+             * @return Size
+             */
+            template<class Compare> size_t RMQ<Compare>::size() const {
+                return _values.size();
+            }
+
+            /**
+             * Picks the best of two values
+             * @param a Value
+             * @param b Value
+             * @return Best value
+             */
+            template<class Compare> size_t RMQ<Compare>::best( const size_t &a, const size_t &b ) const {
+                return _compare( b, a ) ? b : a;
+            }
+
+            /**
+             * Gets the best value in a range within a block
+             * (the lowest position still on the stack at 'to' from 'from' onwards)
+             * @param from First position of the range
+             * @param to   Last position of the range (same block)
+             * @return Best value
+             */
+            template<class Compare> size_t RMQ<Compare>::queryBlock( const size_t &from, const size_t &to ) const {
+                auto first = from - from % BLOCK_SIZE;
+                auto mask  = _masks[ to ] & ( ~uint64_t( 0 ) << ( from - first ) );
+                return _values[ first + __builtin_ctzll( mask ) ];
+            }
+
+            /**
+             * Gets the position of the highest bit set
+             * @param x Non-zero value
+             * @return floor( log2( x ) )
+             */
+            template<class Compare> size_t RMQ<Compare>::log2( const uint64_t &x ) {
+                return 63 - __builtin_clzll( x );
+            }
+        }
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_RMQ_H
@@ -0,0 +1,101 @@
+/**
+    @class          sbp::algo::container::SuperBubbleReporter
+    @brief          Translates the superbubbles found in the DAG of a SubGraph into superbubbles of the graph
+
+    Superbubbles with r/r', going from a duplicate to an original, from a node to its own copy or
+    closing a cycle (exit with an edge to the entrance) have no equivalent in the graph. Those going
+    from an original s to a duplicate t' are the superbubble (s, t) of the graph: its exit was reached
+    through a back edge. A superbubble found more than once (in both node copies or across them) is
+    reported once.
+
+    @dependencies   sbp::algo::container::SuperBubble, sbp::graph::DAG/sbp::graph::ImplicitDAG
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_SUPERBUBBLEREPORTER_H
+#define SUPERBUBBLE_PERFORMANCE_SUPERBUBBLEREPORTER_H
+
+#include <list>
+#include <set>
+#include "SuperBubble.h"
+
+namespace sbp {
+    namespace algo {
+        namespace container {
+            template<class DAG_t, class SubGraph_t> class SuperBubbleReporter {
+              public:
+                SuperBubbleReporter( const DAG_t &dag,
+                                     const SubGraph_t &sub_graph,
+                                     std::list<SuperBubble> &superbubble_list );
+                ~SuperBubbleReporter();
+                bool report( const size_t &s, const size_t &t );
+              private:
+                bool hasEdgeToEntrance( const size_t &s, const size_t &t ) const;
+                const DAG_t                          &_dag;
+                const SubGraph_t                     &_sub_graph;
+                std::list<SuperBubble>               &_superbubble_list;
+                std::set<std::pair<size_t, size_t>>  _reported; //global IDs
+            };
+
+            /**
+             * Constructor
+             * @param dag              DAG (explicit or implicit)
+             * @param sub_graph        SubGraph the DAG was converted from (for the global IDs)
+             * @param superbubble_list SuperBubble list container to fill
+             */
+            template<class DAG_t, class SubGraph_t> SuperBubbleReporter<DAG_t, SubGraph_t>::SuperBubbleReporter( const DAG_t &dag,
+                                                                                                               const SubGraph_t &sub_graph,
+                                                                                                               std::list<SuperBubble> &superbubble_list ) :
+                _dag( dag ),
+                _sub_graph( sub_graph ),
+                _superbubble_list( superbubble_list )
+            {}
+
+            /**
+             * Destructor
+             */
+            template<class DAG_t, class SubGraph_t> SuperBubbleReporter<DAG_t, SubGraph_t>::~SuperBubbleReporter() {}
+
+            /**
+             * Reports a superbubble of the DAG in the list if it has an equivalent in the graph
+             * @param s Local DAG ID of the entrance
+             * @param t Local DAG ID of the exit
+             * @return Reported state
+             */
+            template<class DAG_t, class SubGraph_t> bool SuperBubbleReporter<DAG_t, SubGraph_t>::report( const size_t &s, const size_t &t ) {
+                if( s == _dag.getSourceID() || s == _dag.getTerminalID() || t == _dag.getSourceID() || t == _dag.getTerminalID()
+                    || ( _dag.isDuplicate( s ) && !_dag.isDuplicate( t ) )
+                    || _dag.getOriginalID( s ) == _dag.getOriginalID( t )
+                    || hasEdgeToEntrance( s, t ) ) {
+                    return false;
+                }
+                auto superbubble = SuperBubble( { _sub_graph.getGlobalID( _dag.getGlobalID( s ) ),
+                                                  _sub_graph.getGlobalID( _dag.getGlobalID( t ) ) } );
+                if( !_reported.emplace( superbubble._in_id, superbubble._out_id ).second ) {
+                    return false;
+                }
+                _superbubble_list.emplace_back( superbubble );
+                return true;
+            }
+
+            /**
+             * Checks if the exit of a superbubble has an edge to its entrance in the graph
+             * (t->s is either t->s and t'->s' or, as a back edge, t->s')
+             * @param s Local DAG ID of the entrance
+             * @param t Local DAG ID of the exit
+             * @return Edge to entrance state
+             */
+            template<class DAG_t, class SubGraph_t> bool SuperBubbleReporter<DAG_t, SubGraph_t>::hasEdgeToEntrance( const size_t &s, const size_t &t ) const {
+                auto   entrance = _dag.getOriginalID( s );
+                auto   cursor   = _dag.childCursor( _dag.getOriginalID( t ) );
+                size_t child { 0 };
+                while( _dag.nextChild( cursor, child ) ) {
+                    if( child == entrance || child == _dag.getDuplicateID( entrance ) ) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+        }
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_SUPERBUBBLEREPORTER_H
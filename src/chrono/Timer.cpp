@@ -46,6 +46,7 @@ bool sbp::chrono::Timer::outputToFile( eadlib::io::FileWriter &writer, const std
                 << " ms" << std::endl;
             writer.write( oss.str() );
         }
+        return true;
     } else {
         LOG_ERROR( "sbp::chrono::Timer::export( ", writer.getFileName(), ", ", timer_name, " )] Not enough time marks for export." );
         return false;
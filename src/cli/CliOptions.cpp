@@ -47,12 +47,24 @@ bool sbp::cli::CliOptions::parse( const int &argc,
             option_container.remove_flag = true;
             option_container.graph_name = val.front().second;
         }
+        val = _parser.getValues( "-a" );
+        if( !val.empty() && val.front().first ) {
+            option_container.append_flag = true;
+            option_container.graph_name = val.front().second;
+        }
         option_container.list_flag = _parser.optionUsed( "-l" );
+        option_container.blob_flag = _parser.optionUsed( "-b" );
+        option_container.cache_flag = _parser.optionUsed( "-ca" );
         //Superbubble algorithm options
         option_container.compress_flag = _parser.optionUsed( "-c" );
-        option_container.sb1 = _parser.optionUsed( "-sb1" );
+        option_container.order_flag    = _parser.optionUsed( "-o" );
         option_container.sb2 = _parser.optionUsed( "-sb2" );
         option_container.sb3 = _parser.optionUsed( "-sb3" );
+        option_container.sb4 = _parser.optionUsed( "-sb4" );
+        option_container.sb1 = _parser.optionUsed( "-sb1" ) //default when no algorithm is selected
+                               || !( option_container.sb2 || option_container.sb3 || option_container.sb4 );
+        //Pipeline options
+        option_container.checkpoint_flag = _parser.optionUsed( "-cp" );
         return true;
     }
     return false;
@@ -82,12 +94,20 @@ void sbp::cli::CliOptions::init( char **argv ) {
                     { { std::regex( "(_?[0-9a-zA-Z]+_?)+" ), "Graph name invalid.", "" } } );
     _parser.option( "Database", "-r", "", "Deletes specified graph from the database.", false,
                     { { std::regex( "(_?[0-9a-zA-Z]+_?)+" ), "Graph name invalid.", "" } } );
+    _parser.option( "Database", "-a", "", "Appends the reads to the specified graph already in the database.", false,
+                    { { std::regex( "(_?[0-9a-zA-Z]+_?)+" ), "Graph name invalid.", "" } } );
     _parser.option( "Database", "-l", "", "Lists all the graphs in the database.", false, {} );
+    _parser.option( "Database", "-b", "", "Stores the graph as compact per-node adjacency BLOBs.", false, {} );
+    _parser.option( "Database", "-ca", "", "Reuses a graph built from the same input if one is in the database.", false, {} );
     //Superbubble algorithm options
     _parser.option( "Algorithms", "-c",   "", "Compresses the K-mer graph.", false, {} );
-    _parser.option( "Algorithms", "-sb1", "", "Uses Quasi-Linear time superbubble algorithm.", false, {} );
-    _parser.option( "Algorithms", "-sb2", "", "Uses N Log N time superbubble algorithm.", false, {} );
+    _parser.option( "Algorithms", "-o",   "", "Renumbers the graph nodes so neighbours get close IDs.", false, {} );
+    _parser.option( "Algorithms", "-sb1", "", "Uses Quasi-Linear time superbubble algorithm (default, checkpointed with -cp).", false, {} );
+    _parser.option( "Algorithms", "-sb2", "", "Uses Linear time superbubble algorithm.", false, {} );
     _parser.option( "Algorithms", "-sb3", "", "Uses Quadratic time superbubble algorithm.", false, {} );
+    _parser.option( "Algorithms", "-sb4", "", "Uses the O(m log m) dominator tree superbubble algorithm.", false, {} );
+    //Pipeline options
+    _parser.option( "Pipeline", "-cp", "", "Checkpoints each stage and resumes from the latest valid checkpoint.", false, {} );
 
     _parser.addExampleLine( "To pass your user name to the program: " + std::string( argv[ 0 ] ) + " -n myUserName01" );
 }
@@ -17,14 +17,21 @@ namespace sbp {
             //Database options
             bool        save_flag   { false };       //Save graph to DB (-s)
             bool        remove_flag { false };       //Deletes graph from DB (-r)
+            bool        append_flag { false };       //Appends the reads to a graph in the DB (-a)
             std::string graph_name  { "" };          //Name of the graph
             std::string db_name     { "graphs.db" }; //Name of the DB file
             bool        list_flag   { false };       //List DB graphs names
+            bool        blob_flag   { false };       //Store graph as compact adjacency BLOBs (-b)
+            bool        cache_flag  { false };       //Reuse a stored graph built from the same input (-ca)
             //Superbubble algorithm options
             bool compress_flag  { false };
-            bool sb1            { false };
-            bool sb2            { false };
-            bool sb3            { false };
+            bool order_flag     { false }; //Renumber nodes for locality (-o)
+            bool sb1            { false }; //Quasi-linear (-sb1, or when no algorithm is selected)
+            bool sb2            { false }; //Linear (-sb2)
+            bool sb3            { false }; //Quadratic (-sb3)
+            bool sb4            { false }; //Dominator tree (-sb4)
+            //Pipeline options
+            bool checkpoint_flag { false }; //Checkpoint each stage and resume from the latest valid one (-cp)
         };
     }
 }
@@ -8,7 +8,9 @@ sbp::graph::DAG::DAG( const std::string &name ) :
     eadlib::Graph<size_t>( name ),
     _entrance_node( 0 ),
     _exit_node( 1 ),
-    _unique_node_count( 2 )
+    _unique_node_count( 2 ),
+    _graph_source( true ),
+    _graph_terminal( true )
 {
     eadlib::Graph<size_t>::addNode( 0 ); //r
     eadlib::Graph<size_t>::addNode( 1 ); //r'
@@ -42,6 +44,50 @@ void sbp::graph::DAG::addNodes( const sbp::graph::SubGraph &sub_graph ) {
     std::cout << "End: id1=" << local_id1 << ", id2=" << local_id2 << std::endl;
 }
 
+/**
+ * Adds and duplicate the Nodes between r and r' from a SubGraph view
+ * (mapped to their local ID in the view as addNodes( SubGraph ) does)
+ * @param sub_graph SubGraph view to add the nodes from
+ */
+void sbp::graph::DAG::addNodes( const sbp::graph::SubGraphView &sub_graph ) {
+    auto local_ids = std::vector<size_t>( sub_graph.nodeCount() - 2 );
+    for( size_t i = 0; i < local_ids.size(); i++ ) {
+        local_ids[ i ] = i + 2;
+    }
+    addNodes( local_ids );
+}
+
+/**
+ * Adds and duplicate a set of nodes
+ * (same local ID layout as addNodes( SubGraph ): the n-th ID given is mapped to local IDs 2+n and 2+n+count)
+ * @param global_ids Global IDs of the nodes in local ID order
+ */
+void sbp::graph::DAG::addNodes( const std::vector<size_t> &global_ids ) {
+    auto local_id1 = nodeCount();
+    auto local_id2 = nodeCount() + global_ids.size(); //Node copy offset
+    for( auto global_id : global_ids ) {
+        _local2global_map.emplace( std::make_pair( local_id1, global_id ) );
+        _local2global_map.emplace( std::make_pair( local_id2, global_id ) );
+        _global2local_map.emplace( std::make_pair( global_id, std::make_pair( local_id1, local_id2 ) ) );
+        eadlib::Graph<size_t>::addNode( local_id1 );
+        eadlib::Graph<size_t>::addNode( local_id2 );
+        local_id1++;
+        local_id2++;
+        _unique_node_count++;
+    }
+}
+
+/**
+ * Sets whether the edges from r and to r' stand for edges of the graph
+ * (they don't when they were only added to open/close the DAG of an SCC no edge comes into/goes out of)
+ * @param source   Edges from r are edges of the graph
+ * @param terminal Edges to r' are edges of the graph
+ */
+void sbp::graph::DAG::setGraphLinks( const bool &source, const bool &terminal ) {
+    _graph_source   = source;
+    _graph_terminal = terminal;
+}
+
 /**
  * Finds a node from its local ID
  * @param node Local ID of node to find
@@ -51,6 +97,30 @@ eadlib::Graph<unsigned long>::const_iterator sbp::graph::DAG::findLocalID( const
     return find( node );
 }
 
+/**
+ * Gets a cursor over the children of a node
+ * @param node Local ID of node
+ * @return Cursor on the first child
+ */
+sbp::graph::DAG::ChildCursor sbp::graph::DAG::childCursor( const size_t &node ) const {
+    const auto &children = at( node ).childrenList;
+    return ChildCursor( { children.begin(), children.end() } );
+}
+
+/**
+ * Moves a cursor to the next child of its node
+ * @param cursor Child cursor
+ * @param child  Container for the local ID of the child
+ * @return Child found (false when the cursor has gone past the last one)
+ */
+bool sbp::graph::DAG::nextChild( ChildCursor &cursor, size_t &child ) const {
+    if( cursor._it == cursor._end ) {
+        return false;
+    }
+    child = *( cursor._it++ );
+    return true;
+}
+
 /**
  * Finds a the 2 local nodes from their shared global ID
  * @param node Global ID of nodes to find
@@ -84,6 +154,89 @@ size_t sbp::graph::DAG::getTerminalID() const {
     return _exit_node;
 }
 
+/**
+ * Gets the ID of the duplicate of a node
+ * @param node Local ID of an original node
+ * @return Local ID of the duplicate
+ */
+size_t sbp::graph::DAG::getDuplicateID( const size_t &node ) const {
+    return node + _unique_node_count - 2;
+}
+
+/**
+ * Gets the original of a node
+ * @param node Local ID (original or duplicate)
+ * @return Local ID of the original
+ */
+size_t sbp::graph::DAG::getOriginalID( const size_t &node ) const {
+    return isDuplicate( node ) ? node - _unique_node_count + 2 : node;
+}
+
+/**
+ * Checks if a node is a duplicate
+ * @param node Local ID
+ * @return Duplicate state
+ */
+bool sbp::graph::DAG::isDuplicate( const size_t &node ) const {
+    return node >= _unique_node_count;
+}
+
+/**
+ * Checks if a node's copy is missing some of the children its node has in the SubGraph
+ * (edges to r' are only on the duplicates and back edges only leave the originals)
+ * Edges to r' only count when they are edges of the graph (see setGraphLinks(..)).
+ * @param node Local ID
+ * @return Missing children state (false for r/r')
+ */
+bool sbp::graph::DAG::hasMissingChildren( const size_t &node ) const {
+    if( node == _entrance_node || node == _exit_node ) {
+        return false;
+    }
+    auto duplicate = isDuplicate( node );
+    for( auto child : at( duplicate ? getOriginalID( node ) : getDuplicateID( node ) ).childrenList ) {
+        if( duplicate ? isDuplicate( child ) : _graph_terminal && child == _exit_node ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Checks if a node's copy is missing some of the parents its node has in the SubGraph
+ * (edges from r are only on the originals and back edges only reach the duplicates)
+ * Edges from r only count when they are edges of the graph (see setGraphLinks(..)).
+ * @param node Local ID
+ * @return Missing parents state (false for r/r')
+ */
+bool sbp::graph::DAG::hasMissingParents( const size_t &node ) const {
+    if( node == _entrance_node || node == _exit_node ) {
+        return false;
+    }
+    auto duplicate = isDuplicate( node );
+    for( auto parent : at( duplicate ? getOriginalID( node ) : getDuplicateID( node ) ).parentsList ) {
+        if( duplicate ? _graph_source && parent == _entrance_node : parent != _entrance_node && !isDuplicate( parent ) ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Checks if the edges from r stand for edges of the graph
+ * @return Graph source state
+ */
+bool sbp::graph::DAG::hasGraphSource() const {
+    return _graph_source;
+}
+
+/**
+ * Checks if the edges to r' stand for edges of the graph
+ * @return Graph terminal state
+ */
+bool sbp::graph::DAG::hasGraphTerminal() const {
+    return _graph_terminal;
+}
+
 /**
  * Gets the global ID from a local one
  * @param local Local ID
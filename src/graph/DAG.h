@@ -4,27 +4,44 @@
 
     DAG class to store a SubGraph converted to DAG in.
 
-    @dependencies   sbp::graph::SubGraph
+    @dependencies   sbp::graph::SubGraph, sbp::graph::SubGraphView
 **/
 #ifndef SUPERBUBBLE_PERFORMANCE_DAG_H
 #define SUPERBUBBLE_PERFORMANCE_DAG_H
 
 #include <eadlib/logger/Logger.h>
 #include "SubGraph.h"
+#include "SubGraphView.h"
 
 namespace sbp {
     namespace graph {
         class DAG : public eadlib::Graph<size_t> {
           public:
+            struct ChildCursor {
+                std::list<size_t>::const_iterator _it;
+                std::list<size_t>::const_iterator _end;
+            };
             DAG( const std::string &name );
             ~DAG();
             //Manipulation
             void addNodes( const SubGraph &sub_graph );
+            void addNodes( const SubGraphView &sub_graph );
+            void addNodes( const std::vector<size_t> &global_ids );
+            void setGraphLinks( const bool &source, const bool &terminal );
             //Access
             const_iterator findLocalID( const size_t &node ) const;
+            ChildCursor childCursor( const size_t &node ) const;
+            bool nextChild( ChildCursor &cursor, size_t &child ) const;
             std::pair<const_iterator, const_iterator> findGlobalIDs( const size_t &node ) const;
             size_t getSourceID() const;
             size_t getTerminalID() const;
+            size_t getDuplicateID( const size_t &node ) const;
+            size_t getOriginalID( const size_t &node ) const;
+            bool isDuplicate( const size_t &node ) const;
+            bool hasMissingChildren( const size_t &node ) const;
+            bool hasMissingParents( const size_t &node ) const;
+            bool hasGraphSource() const;
+            bool hasGraphTerminal() const;
             //Translation
             size_t getGlobalID( const size_t local ) const;
             std::pair<size_t, size_t> getLocalID( const size_t global ) const;
@@ -40,6 +57,8 @@ namespace sbp {
             size_t                                                _entrance_node;     // r
             size_t                                                _exit_node;         // r'
             size_t                                                _unique_node_count; //
+            bool                                                  _graph_source;      //edges from r are edges into the SCC
+            bool                                                  _graph_terminal;    //edges to r' are edges out of the SCC
         };
     }
 }
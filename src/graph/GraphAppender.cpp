@@ -0,0 +1,248 @@
+#include "GraphAppender.h"
+
+/**
+ * Constructor
+ * @param db Database access instance
+ */
+sbp::graph::GraphAppender::GraphAppender( sbp::io::Database &db ) :
+    _db( db )
+{}
+
+/**
+ * Destructor
+ */
+sbp::graph::GraphAppender::~GraphAppender() {}
+
+/**
+ * Appends a graph of new reads to a graph stored in the database
+ * (only the stored nodes sharing K-mers with the new reads and their direct neighbours are read back,
+ * re-compressed and rewritten so the work scales with the size of the new data)
+ * @param graph_name Name of the stored graph
+ * @param kmer_size  K-mer length the stored graph was built with
+ * @param delta      Uncompressed K-mer graph of the new reads
+ * @return Success
+ */
+bool sbp::graph::GraphAppender::append( const std::string &graph_name,
+                                        const size_t &kmer_size,
+                                        const eadlib::WeightedGraph<std::string> &delta ) {
+    if( delta.isEmpty() ) {
+        return true;
+    }
+    if( !_db.prepareAppend( graph_name, kmer_size ) ) {
+        return false;
+    }
+    auto graph_ID     = _db.getID( graph_name );
+    auto stored_count = _db.countNodes( graph_name );
+    if( stored_count < 0 ) {
+        LOG_ERROR( "[sbp::graph::GraphAppender::append( ", graph_name, ", ", kmer_size, ", <WeightedGraph<std::string>> )] Couldn't count the stored nodes." );
+        return false;
+    }
+    //Rebuilding the affected region of the graph in memory
+    std::unordered_map<size_t, std::string> touched;
+    std::unordered_map<std::string, size_t> anchors;
+    auto region = eadlib::WeightedGraph<std::string>( graph_name );
+    if( !buildRegion( graph_name, kmer_size, delta, touched, anchors, region ) ) {
+        return false;
+    }
+    std::cout << "-> Append: " << touched.size() << " stored node(s) touched, "
+              << anchors.size() << " neighbour(s) kept as they are." << std::endl;
+    std::unordered_set<std::string> frozen;
+    for( const auto &anchor : anchors ) {
+        frozen.emplace( anchor.first );
+    }
+    auto compressor = sbp::algo::GraphCompressor( region, frozen );
+    compressor.compress();
+    std::vector<std::pair<size_t, std::string>> region_nodes;
+    for( const auto &node : region ) {
+        if( frozen.find( node.first ) == frozen.end() ) {
+            region_nodes.emplace_back( node.second.id, node.first );
+        }
+    }
+    std::sort( region_nodes.begin(), region_nodes.end() );
+    //Node IDs: the region reuses the touched nodes' IDs first then extends the ID range.
+    //If the region shrank, the top stored nodes are moved into the holes so the IDs stay dense.
+    std::vector<size_t> free_ids;
+    for( const auto &node : touched ) {
+        free_ids.emplace_back( node.first );
+    }
+    std::sort( free_ids.begin(), free_ids.end() );
+    auto old_count = static_cast<size_t>( stored_count );
+    auto new_count = old_count - touched.size() + region_nodes.size();
+    std::unordered_map<std::string, size_t> ids;
+    std::vector<std::pair<size_t, size_t>> moves; //(from, to)
+    for( size_t i = 0; i < region_nodes.size(); i++ ) {
+        ids.emplace( region_nodes.at( i ).second, i < free_ids.size() ? free_ids.at( i ) : old_count + i - free_ids.size() );
+    }
+    if( region_nodes.size() < free_ids.size() ) {
+        std::unordered_set<size_t> freed( free_ids.begin(), free_ids.end() );
+        auto hole = free_ids.begin() + region_nodes.size();
+        for( size_t id = new_count; id < old_count; id++ ) {
+            if( freed.find( id ) == freed.end() ) {
+                moves.emplace_back( id, *hole );
+                ++hole;
+            }
+        }
+    }
+    std::unordered_map<size_t, size_t> moved( moves.begin(), moves.end() );
+    for( const auto &anchor : anchors ) {
+        auto it = moved.find( anchor.second );
+        ids.emplace( anchor.first, it == moved.end() ? anchor.second : it->second );
+    }
+    //Swapping the touched nodes for the region
+    std::cout << "-> DB: rewriting " << region_nodes.size() << " node(s) in place of " << touched.size()
+              << " (" << moves.size() << " node(s) renumbered)." << std::endl;
+    bool success { true };
+    _db.beginTransaction();
+    success &= _db.removeNodes( graph_name, touched, kmer_size );
+    for( const auto &move : moves ) {
+        success &= _db.moveNode( graph_name, move.first, move.second, kmer_size );
+    }
+    for( const auto &node : region_nodes ) {
+        success &= _db.writeNode( graph_ID, ids.at( node.second ), node.second );
+        success &= _db.writeKmerLocations( graph_ID, ids.at( node.second ), node.second, kmer_size );
+    }
+    for( const auto &node : region ) {
+        auto from_region = frozen.find( node.first ) == frozen.end();
+        for( const auto &child : node.second.childrenList ) {
+            if( from_region || frozen.find( child ) == frozen.end() ) {
+                success &= _db.writeEdge( graph_ID, ids.at( node.first ), ids.at( child ), node.second.weight.at( child ) );
+            }
+        }
+    }
+    success &= _db.flush();
+    if( !success ) {
+        _db.rollbackTransaction();
+        LOG_ERROR( "[sbp::graph::GraphAppender::append( ", graph_name, ", ", kmer_size, ", <WeightedGraph<std::string>> )] Couldn't rewrite the graph region." );
+        return false;
+    }
+    _db.commitTransaction();
+    //Anything derived from the previous version of the graph is stale now
+    return _db.setMetadata( graph_name, "snapshot", "" ) && _db.setMetadata( graph_name, "fingerprint", "" );
+}
+
+/**
+ * Rebuilds, uncompressed, the part of the stored graph affected by the new reads and adds the reads to it
+ * @param graph_name Name of the stored graph
+ * @param kmer_size  K-mer length the stored graph was built with
+ * @param delta      Uncompressed K-mer graph of the new reads
+ * @param touched    Container for the stored nodes holding K-mers of the new reads (ID -> K-mer string)
+ * @param anchors    Container for the untouched stored neighbours of the touched nodes (K-mer string -> ID)
+ * @param region     Graph instance to build the region into
+ * @return Success
+ */
+bool sbp::graph::GraphAppender::buildRegion( const std::string &graph_name,
+                                             const size_t &kmer_size,
+                                             const eadlib::WeightedGraph<std::string> &delta,
+                                             std::unordered_map<size_t, std::string> &touched,
+                                             std::unordered_map<std::string, size_t> &anchors,
+                                             eadlib::WeightedGraph<std::string> &region ) {
+    //Stored nodes holding K-mers of the new reads
+    std::vector<std::string> kmers;
+    for( const auto &node : delta ) {
+        kmers.emplace_back( node.first );
+    }
+    std::unordered_map<std::string, size_t> locations;
+    if( !_db.findKmers( graph_name, kmers, locations ) ) {
+        LOG_ERROR( "[sbp::graph::GraphAppender::buildRegion( ", graph_name, ", ", kmer_size, ", .. )] Couldn't locate the K-mers in the stored graph." );
+        return false;
+    }
+    std::unordered_set<size_t> touched_set;
+    for( const auto &location : locations ) {
+        touched_set.emplace( location.second );
+    }
+    std::vector<size_t> touched_ids( touched_set.begin(), touched_set.end() );
+    EdgeRows_t edges;
+    if( !_db.readNodes( graph_name, touched_ids, touched )
+        || !_db.readEdges( graph_name, touched_ids, [&]( const size_t &from, const size_t &to, const size_t &weight ) {
+            edges[ std::make_pair( from, to ) ] = weight;
+        } ) ) {
+        LOG_ERROR( "[sbp::graph::GraphAppender::buildRegion( ", graph_name, ", ", kmer_size, ", .. )] Couldn't read the touched nodes." );
+        return false;
+    }
+    //Untouched neighbours
+    std::vector<size_t> anchor_ids;
+    for( const auto &edge : edges ) {
+        if( touched_set.find( edge.first.first ) == touched_set.end() ) {
+            anchor_ids.emplace_back( edge.first.first );
+        }
+        if( touched_set.find( edge.first.second ) == touched_set.end() ) {
+            anchor_ids.emplace_back( edge.first.second );
+        }
+    }
+    std::sort( anchor_ids.begin(), anchor_ids.end() );
+    anchor_ids.erase( std::unique( anchor_ids.begin(), anchor_ids.end() ), anchor_ids.end() );
+    std::unordered_map<size_t, std::string> anchor_nodes;
+    if( !_db.readNodes( graph_name, anchor_ids, anchor_nodes ) ) {
+        LOG_ERROR( "[sbp::graph::GraphAppender::buildRegion( ", graph_name, ", ", kmer_size, ", .. )] Couldn't read the neighbouring nodes." );
+        return false;
+    }
+    for( const auto &anchor : anchor_nodes ) {
+        anchors.emplace( anchor.second, anchor.first );
+        region.addNode( anchor.second );
+    }
+    //Touched nodes are expanded back into K-mer chains.
+    //The compressor only merges chains of equal edge weights so the weight inside a node is the one of its
+    //single out-going edge. Nodes without one fall back on their single in-coming edge's weight (or 1).
+    std::unordered_map<size_t, std::pair<size_t, size_t>> out_edges; //ID -> (count, weight)
+    std::unordered_map<size_t, std::pair<size_t, size_t>> in_edges;
+    for( const auto &edge : edges ) {
+        auto &out = out_edges[ edge.first.first ];
+        out.first++;
+        out.second = edge.second;
+        auto &in = in_edges[ edge.first.second ];
+        in.first++;
+        in.second = edge.second;
+    }
+    for( const auto &node : touched ) {
+        size_t weight { 1 };
+        auto out = out_edges.find( node.first );
+        auto in  = in_edges.find( node.first );
+        if( out != out_edges.end() && out->second.first == 1 ) {
+            weight = out->second.second;
+        } else if( ( out == out_edges.end() ) && in != in_edges.end() && in->second.first == 1 ) {
+            weight = in->second.second;
+        }
+        expand( node.second, kmer_size, weight, region );
+    }
+    for( const auto &edge : edges ) {
+        auto from = touched.find( edge.first.first );
+        auto to   = touched.find( edge.first.second );
+        region.createDirectedEdge_fast( from != touched.end() ? from->second.substr( from->second.size() - kmer_size )
+                                                              : anchor_nodes.at( edge.first.first ),
+                                        to != touched.end() ? to->second.substr( 0, kmer_size )
+                                                            : anchor_nodes.at( edge.first.second ),
+                                        edge.second );
+    }
+    //New reads
+    for( const auto &node : delta ) {
+        if( !region.nodeExists( node.first ) ) {
+            region.addNode( node.first );
+        }
+        for( const auto &child : node.second.childrenList ) {
+            region.createDirectedEdge_fast( node.first, child, node.second.weight.at( child ) );
+        }
+    }
+    return true;
+}
+
+/**
+ * Expands a compressed node into its chain of K-mers
+ * @param node      Node's K-mer string
+ * @param kmer_size K-mer length
+ * @param weight    Weight of the edges inside the chain
+ * @param region    Graph instance to add the chain to
+ */
+void sbp::graph::GraphAppender::expand( const std::string &node,
+                                        const size_t &kmer_size,
+                                        const size_t &weight,
+                                        eadlib::WeightedGraph<std::string> &region ) const {
+    if( node.size() <= kmer_size ) {
+        if( !region.nodeExists( node ) ) {
+            region.addNode( node );
+        }
+        return;
+    }
+    for( size_t i = 0; i + kmer_size < node.size(); i++ ) {
+        region.createDirectedEdge_fast( node.substr( i, kmer_size ), node.substr( i + 1, kmer_size ), weight );
+    }
+}
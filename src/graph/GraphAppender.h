@@ -0,0 +1,41 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_GRAPHAPPENDER_H
+#define SUPERBUBBLE_PERFORMANCE_GRAPHAPPENDER_H
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "eadlib/logger/Logger.h"
+#include "eadlib/datastructure/WeightedGraph.h"
+#include "../io/Database.h"
+#include "../algorithm/GraphCompressor.h"
+
+namespace sbp {
+    namespace graph {
+        class GraphAppender {
+          public:
+            GraphAppender( sbp::io::Database &db );
+            ~GraphAppender();
+            bool append( const std::string &graph_name,
+                         const size_t &kmer_size,
+                         const eadlib::WeightedGraph<std::string> &delta );
+          private:
+            typedef std::map<std::pair<size_t, size_t>, size_t> EdgeRows_t;
+            bool buildRegion( const std::string &graph_name,
+                              const size_t &kmer_size,
+                              const eadlib::WeightedGraph<std::string> &delta,
+                              std::unordered_map<size_t, std::string> &touched,
+                              std::unordered_map<std::string, size_t> &anchors,
+                              eadlib::WeightedGraph<std::string> &region );
+            void expand( const std::string &node,
+                         const size_t &kmer_size,
+                         const size_t &weight,
+                         eadlib::WeightedGraph<std::string> &region ) const;
+            sbp::io::Database &_db;
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_GRAPHAPPENDER_H
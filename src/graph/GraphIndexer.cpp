@@ -17,59 +17,201 @@ sbp::graph::GraphIndexer::~GraphIndexer() {}
  * Indexes and stores kmer string graph in database
  * @param graph_name Name of graph
  * @param graph      Kmer deBruijn Graph
+ * @param schema     Storage layout to use in the database
  * @return Success
  */
-bool sbp::graph::GraphIndexer::storeIntoDB( const std::string &graph_name, const eadlib::WeightedGraph<std::string> &graph ) {
-    //Error control
-    if( !_db.isOpen() ) {
-        LOG_ERROR( "[sbp::graph::GraphIndexer::storeIntoDB( ", graph_name, ", <eadlib::WeightedGraph> )] Database not open." );
+bool sbp::graph::GraphIndexer::storeIntoDB( const std::string &graph_name,
+                                            const eadlib::WeightedGraph<std::string> &graph,
+                                            const sbp::io::StorageSchema &schema ) {
+    std::string graph_ID;
+    if( !prepareGraph( graph_name, schema, graph_ID ) ) {
         return false;
     }
-    if( _db.exists( graph_name ) ) {
-        LOG_ERROR( "[sbp::graph::GraphIndexer::storeIntoDB( ", graph_name, ", <eadlib::WeightedGraph> )] Graph already exists." );
+    if( !graph.hasDenseNodeIDs() ) {
+        LOG_ERROR( "[sbp::graph::GraphIndexer::storeIntoDB( ", graph_name, ", <eadlib::WeightedGraph>, .. )] Graph node IDs are not dense." );
         return false;
     }
-    if( !_db.create( graph_name ) ) {
-        LOG_ERROR( "[sbp::graph::GraphIndexer::storeIntoDB( ", graph_name, ", <eadlib::WeightedGraph> )] Problem creating graph in DB." );
-        return false;
+    if( schema == sbp::io::StorageSchema::ADJACENCY_BLOB ) {
+        return storeAdjacency( graph_ID, graph );
     }
-    std::string graph_ID = _db.getID( graph_name );
-    if( graph_ID == "-1" ) {
-        LOG_ERROR( "[sbp::graph::GraphIndexer::storeIntoDB( ", graph_name, ", <eadlib::WeightedGraph> )] Problem getting graph ID." );
-        return false;
-    }
-    //Indexer
-    std::cout << "-> DB: writing kmer indices." << std::endl;
-    std::unordered_map<std::string, size_t> kmer_index;
-    size_t i { 0 };
-    auto index_progress = eadlib::cli::ProgressBar( graph.nodeCount(), 70 );
+    //Kmer indices and edges (node IDs were given on insertion into the graph)
+    std::cout << "-> DB: writing kmer indices and graph edges." << std::endl;
+    auto progress = eadlib::cli::ProgressBar( graph.nodeCount(), 70 );
+    bool success { true };
     _db.beginTransaction();
-    for( auto node : graph ) {
-        kmer_index.insert( typename std::unordered_map<std::string, size_t>::value_type( node.first, i ) );
-        _db.writeNode( graph_ID, i, node.first );
-        i++;
-        ( index_progress++ ).printPercentBar( std::cout, 2 );
+    for( const auto &node : graph ) {
+        success &= _db.writeNode( graph_ID, node.second.id, node.first );
+        for( const auto &dest : node.second.childrenList ) {
+            success &= _db.writeEdge( graph_ID, node.second.id, graph.getNodeID( dest ), node.second.weight.at( dest ) );
+        }
+        ( ++progress ).printPercentBar( std::cout, 2 );
     }
     _db.commitTransaction();
-    index_progress.complete().printPercentBar( std::cout, 2 );
+    progress.complete().printPercentBar( std::cout, 2 );
     std::cout << std::endl;
-    //Indexed graph
-    std::cout << "-> DB: writing graph edges." << std::endl;
-    auto edge_progress = eadlib::cli::ProgressBar( graph.nodeCount(), 70 );
+    return success;
+}
+
+/**
+ * Stores the kmer string graph as one adjacency row per node
+ * @param graph_ID Graph ID in the database
+ * @param graph    Kmer deBruijn Graph (dense node IDs)
+ * @return Success
+ */
+bool sbp::graph::GraphIndexer::storeAdjacency( const std::string &graph_ID, const eadlib::WeightedGraph<std::string> &graph ) {
+    std::cout << "-> DB: writing node adjacencies." << std::endl;
+    auto progress = eadlib::cli::ProgressBar( graph.nodeCount(), 70 );
+    auto children = sbp::io::AdjacencyCodec::Children_t();
+    bool success { true };
     _db.beginTransaction();
-    for( auto node : graph ) {
-        edge_progress.printPercentBar( std::cout, 2 );
-        size_t origin_node = kmer_index.at( node.first );
-        if( !node.second.childrenList.empty() ) {
-            for( auto dest : node.second.childrenList ) {
-                size_t destination_node = kmer_index.at( dest );
-                _db.writeEdge( graph_ID, origin_node, destination_node, node.second.weight.at( dest ) );
-            }
-            ( edge_progress++ ).printPercentBar( std::cout, 2 );
+    for( const auto &node : graph ) {
+        children.clear();
+        for( const auto &dest : node.second.childrenList ) {
+            children.emplace_back( graph.getNodeID( dest ), node.second.weight.at( dest ) );
         }
+        success &= _db.writeAdjacency( graph_ID, node.second.id, node.first, children );
+        ( ++progress ).printPercentBar( std::cout, 2 );
     }
     _db.commitTransaction();
-    edge_progress.complete().printPercentBar( std::cout, 2 );
+    progress.complete().printPercentBar( std::cout, 2 );
     std::cout << std::endl;
+    return success;
+}
+
+/**
+ * Stores an already indexed graph in the database
+ * @param graph_name  Name of graph
+ * @param index_graph Index graph (dense node IDs)
+ * @param kmers       Kmer string of each node ID in the index graph
+ * @param schema      Storage layout to use in the database
+ * @return Success
+ */
+bool sbp::graph::GraphIndexer::storeIntoDB( const std::string &graph_name,
+                                            const eadlib::WeightedGraph<size_t> &index_graph,
+                                            const std::vector<std::string> &kmers,
+                                            const sbp::io::StorageSchema &schema ) {
+    std::string graph_ID;
+    if( !prepareGraph( graph_name, schema, graph_ID ) ) {
+        return false;
+    }
+    bool success { true };
+    if( schema == sbp::io::StorageSchema::ADJACENCY_BLOB ) {
+        auto children = sbp::io::AdjacencyCodec::Children_t();
+        _db.beginTransaction();
+        for( const auto &node : index_graph ) {
+            children.clear();
+            for( const auto &dest : node.second.childrenList ) {
+                children.emplace_back( dest, node.second.weight.at( dest ) );
+            }
+            success &= _db.writeAdjacency( graph_ID, node.first, kmers.at( node.first ), children );
+        }
+        _db.commitTransaction();
+    } else {
+        _db.beginTransaction();
+        for( size_t i = 0; i < kmers.size(); i++ ) {
+            success &= _db.writeNode( graph_ID, i, kmers[ i ] );
+        }
+        for( const auto &node : index_graph ) {
+            for( const auto &dest : node.second.childrenList ) {
+                success &= _db.writeEdge( graph_ID, node.first, dest, node.second.weight.at( dest ) );
+            }
+        }
+        _db.commitTransaction();
+    }
+    return success;
+}
+
+/**
+ * Indexes a kmer string graph in memory
+ * (node IDs are the ones given on insertion into the kmer graph like when storing in the DB,
+ *  the edges are translated by worker threads and then inserted into the index graph)
+ * @param graph        Kmer deBruijn Graph
+ * @param index_graph  Empty index graph to fill
+ * @param kmers        Container for the kmer string of each node ID (cleared first)
+ * @param thread_count Number of worker threads to use
+ * @return Success
+ */
+bool sbp::graph::GraphIndexer::indexGraph( const eadlib::WeightedGraph<std::string> &graph,
+                                           eadlib::WeightedGraph<size_t> &index_graph,
+                                           std::vector<std::string> &kmers,
+                                           const size_t &thread_count ) {
+    if( !index_graph.isEmpty() ) {
+        LOG_ERROR( "[sbp::graph::GraphIndexer::indexGraph( <eadlib::WeightedGraph>, <eadlib::WeightedGraph>, .. )] Index graph instance not empty." );
+        return false;
+    }
+    if( !graph.hasDenseNodeIDs() ) {
+        LOG_ERROR( "[sbp::graph::GraphIndexer::indexGraph( <eadlib::WeightedGraph>, <eadlib::WeightedGraph>, .. )] Kmer graph node IDs are not dense." );
+        return false;
+    }
+    //Nodes by ID
+    typedef eadlib::WeightedGraph<std::string>::NodeAdjacency Adjacency_t;
+    std::vector<const Adjacency_t *> nodes( graph.nodeCount(), nullptr );
+    kmers.assign( graph.nodeCount(), std::string() );
+    for( const auto &node : graph ) {
+        kmers[ node.second.id ] = node.first;
+        nodes[ node.second.id ] = &node.second;
+    }
+    //Edge translation (read-only lookups so the workers can share the graph)
+    struct Edge {
+        size_t _from;
+        size_t _to;
+        size_t _weight;
+    };
+    size_t worker_count = std::max<size_t>( 1, std::min<size_t>( thread_count, nodes.size() ) );
+    size_t chunk_size   = ( nodes.size() + worker_count - 1 ) / std::max<size_t>( 1, worker_count );
+    std::vector<std::vector<Edge>> edges( worker_count );
+    std::vector<std::thread> workers;
+    for( size_t w = 0; w < worker_count; w++ ) {
+        workers.emplace_back( [&, w]() {
+            size_t end = std::min( nodes.size(), ( w + 1 ) * chunk_size );
+            for( size_t i = w * chunk_size; i < end; i++ ) {
+                for( const auto &child : nodes[ i ]->childrenList ) {
+                    edges[ w ].emplace_back( Edge { i, graph.getNodeID( child ), nodes[ i ]->weight.at( child ) } );
+                }
+            }
+        } );
+    }
+    for( auto &worker : workers ) {
+        worker.join();
+    }
+    //Index graph construction
+    for( size_t i = 0; i < nodes.size(); i++ ) {
+        index_graph.addNode( i );
+    }
+    for( const auto &chunk : edges ) {
+        for( const auto &edge : chunk ) {
+            index_graph.createDirectedEdge_fast( edge._from, edge._to, edge._weight );
+        }
+    }
+    return true;
+}
+
+/**
+ * Checks the database and creates the graph entry to store into
+ * @param graph_name Name of graph
+ * @param schema     Storage layout to use in the database
+ * @param graph_ID   Container for the ID of the created graph
+ * @return Success
+ */
+bool sbp::graph::GraphIndexer::prepareGraph( const std::string &graph_name,
+                                             const sbp::io::StorageSchema &schema,
+                                             std::string &graph_ID ) {
+    if( !_db.isOpen() ) {
+        LOG_ERROR( "[sbp::graph::GraphIndexer::prepareGraph( ", graph_name, ", .. )] Database not open." );
+        return false;
+    }
+    if( _db.exists( graph_name ) ) {
+        LOG_ERROR( "[sbp::graph::GraphIndexer::prepareGraph( ", graph_name, ", .. )] Graph already exists." );
+        return false;
+    }
+    if( !_db.create( graph_name, schema ) ) {
+        LOG_ERROR( "[sbp::graph::GraphIndexer::prepareGraph( ", graph_name, ", .. )] Problem creating graph in DB." );
+        return false;
+    }
+    graph_ID = _db.getID( graph_name );
+    if( graph_ID == "-1" ) {
+        LOG_ERROR( "[sbp::graph::GraphIndexer::prepareGraph( ", graph_name, ", .. )] Problem getting graph ID." );
+        return false;
+    }
     return true;
-}
\ No newline at end of file
+}
@@ -1,6 +1,8 @@
 #ifndef SUPERBUBBLE_PERFORMANCE_GRAPHINDEXER_H
 #define SUPERBUBBLE_PERFORMANCE_GRAPHINDEXER_H
 
+#include <thread>
+#include <vector>
 #include "eadlib/datastructure/WeightedGraph.h"
 #include "eadlib/cli/graphic/ProgressBar.h"
 #include "../io/Database.h"
@@ -11,8 +13,20 @@ namespace sbp {
           public:
             GraphIndexer( sbp::io::Database &db );
             ~GraphIndexer();
-            bool storeIntoDB( const std::string &graph_name, const eadlib::WeightedGraph<std::string> &graph );
+            bool storeIntoDB( const std::string &graph_name,
+                              const eadlib::WeightedGraph<std::string> &graph,
+                              const sbp::io::StorageSchema &schema = sbp::io::StorageSchema::EDGE_ROWS );
+            bool storeIntoDB( const std::string &graph_name,
+                              const eadlib::WeightedGraph<size_t> &index_graph,
+                              const std::vector<std::string> &kmers,
+                              const sbp::io::StorageSchema &schema = sbp::io::StorageSchema::EDGE_ROWS );
+            static bool indexGraph( const eadlib::WeightedGraph<std::string> &graph,
+                                    eadlib::WeightedGraph<size_t> &index_graph,
+                                    std::vector<std::string> &kmers,
+                                    const size_t &thread_count = std::thread::hardware_concurrency() );
           private:
+            bool prepareGraph( const std::string &graph_name, const sbp::io::StorageSchema &schema, std::string &graph_ID );
+            bool storeAdjacency( const std::string &graph_ID, const eadlib::WeightedGraph<std::string> &graph );
             sbp::io::Database &_db;
         };
     }
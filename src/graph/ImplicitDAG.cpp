@@ -0,0 +1,397 @@
+#include "ImplicitDAG.h"
+
+/**
+ * Constructor
+ * @param name    Name of the DAG
+ * @param offsets Offsets of each SubGraph node's children into the targets (node count + 1 entries)
+ * @param targets Children of the SubGraph nodes
+ */
+sbp::graph::ImplicitDAG::ImplicitDAG( const std::string &name,
+                                      std::vector<size_t> &&offsets,
+                                      std::vector<size_t> &&targets ) :
+    _name( name ),
+    _unique_node_count( offsets.empty() ? 0 : offsets.size() - 1 ),
+    _out_offsets( std::move( offsets ) ),
+    _out_targets( std::move( targets ) ),
+    _in_offsets( _unique_node_count + 1, 0 ),
+    _in_edges( _out_targets.size() ),
+    _in_sources( _out_targets.size() ),
+    _edge_types( _out_targets.size(), EdgeType::NONE ),
+    _node_flags( nodeCount(), 0 )
+{
+    for( auto target : _out_targets ) {
+        _in_offsets[ target + 1 ]++;
+    }
+    for( size_t v = 0; v < _unique_node_count; v++ ) {
+        _in_offsets[ v + 1 ] += _in_offsets[ v ];
+    }
+    auto position = std::vector<size_t>( _in_offsets.begin(), _in_offsets.end() - 1 );
+    for( size_t u = 0; u < _unique_node_count; u++ ) {
+        for( auto e = _out_offsets[ u ]; e < _out_offsets[ u + 1 ]; e++ ) {
+            auto i = position[ _out_targets[ e ] ]++;
+            _in_edges[ i ]   = e;
+            _in_sources[ i ] = u;
+        }
+    }
+}
+
+/**
+ * Destructor
+ */
+sbp::graph::ImplicitDAG::~ImplicitDAG() {}
+
+/**
+ * Gets the index of the first out-going edge of a SubGraph node
+ * @param sg_node Local SubGraph ID
+ * @return Edge index
+ */
+size_t sbp::graph::ImplicitDAG::edgesBegin( const size_t &sg_node ) const {
+    return _out_offsets.at( sg_node );
+}
+
+/**
+ * Gets the index after the last out-going edge of a SubGraph node
+ * @param sg_node Local SubGraph ID
+ * @return Edge index
+ */
+size_t sbp::graph::ImplicitDAG::edgesEnd( const size_t &sg_node ) const {
+    return _out_offsets.at( sg_node + 1 );
+}
+
+/**
+ * Gets the target of a SubGraph edge
+ * @param edge Edge index
+ * @return Local SubGraph ID of the target
+ */
+size_t sbp::graph::ImplicitDAG::getEdgeTarget( const size_t &edge ) const {
+    return _out_targets.at( edge );
+}
+
+/**
+ * Sets the type of a SubGraph edge in the DAG
+ * @param edge Edge index
+ * @param type Edge type
+ */
+void sbp::graph::ImplicitDAG::setEdgeType( const size_t &edge, const EdgeType &type ) {
+    _edge_types.at( edge ) = type;
+}
+
+/**
+ * Creates the edge r->node
+ * @param node Local DAG ID
+ */
+void sbp::graph::ImplicitDAG::linkToSource( const size_t &node ) {
+    _node_flags.at( node ) |= FROM_SOURCE;
+}
+
+/**
+ * Creates the edge node->r'
+ * @param node Local DAG ID
+ */
+void sbp::graph::ImplicitDAG::linkToTerminal( const size_t &node ) {
+    _node_flags.at( node ) |= TO_TERMINAL;
+}
+
+/**
+ * Creates the DAG in explicit form
+ * @param dag Empty DAG
+ */
+void sbp::graph::ImplicitDAG::materialise( sbp::graph::DAG &dag ) const {
+    auto sg_ids = std::vector<size_t>( getUniqueNodeCount() - 2 );
+    for( size_t i = 0; i < sg_ids.size(); i++ ) {
+        sg_ids[ i ] = i + 2;
+    }
+    dag.addNodes( sg_ids );
+    dag.setGraphLinks( _out_offsets[ getSourceID() ] != _out_offsets[ getSourceID() + 1 ],
+                       _in_offsets[ getTerminalID() ] != _in_offsets[ getTerminalID() + 1 ] );
+    for( size_t node = 0; node < nodeCount(); node++ ) {
+        for( auto child : at( node ).childrenList ) {
+            dag.createDirectedEdge_fast( node, child );
+        }
+    }
+}
+
+/**
+ * Gets the type of a SubGraph edge in the DAG
+ * @param edge Edge index
+ * @return Edge type
+ */
+sbp::graph::ImplicitDAG::EdgeType sbp::graph::ImplicitDAG::getEdgeType( const size_t &edge ) const {
+    return _edge_types.at( edge );
+}
+
+/**
+ * Gets the adjacency of a node
+ * @param node Local DAG ID
+ * @return Node with the local DAG IDs of its children and parents
+ */
+sbp::graph::ImplicitDAG::Node sbp::graph::ImplicitDAG::at( const size_t &node ) const {
+    auto adjacency = Node();
+    if( node == getSourceID() ) {
+        for( size_t v = 2; v < nodeCount(); v++ ) {
+            if( _node_flags[ v ] & FROM_SOURCE ) {
+                adjacency.childrenList.emplace_back( v );
+            }
+        }
+    } else if( node == getTerminalID() ) {
+        for( size_t v = 2; v < nodeCount(); v++ ) {
+            if( _node_flags[ v ] & TO_TERMINAL ) {
+                adjacency.parentsList.emplace_back( v );
+            }
+        }
+    } else {
+        auto duplicate = isDuplicate( node );
+        auto v         = getOriginalID( node );
+        for( auto e = _out_offsets[ v ]; e < _out_offsets[ v + 1 ]; e++ ) {
+            if( _edge_types[ e ] == EdgeType::TREE ) {
+                adjacency.childrenList.emplace_back( duplicate ? getDuplicateID( _out_targets[ e ] ) : _out_targets[ e ] );
+            } else if( _edge_types[ e ] == EdgeType::BACK && !duplicate ) {
+                adjacency.childrenList.emplace_back( getDuplicateID( _out_targets[ e ] ) );
+            }
+        }
+        if( _node_flags[ node ] & TO_TERMINAL ) {
+            adjacency.childrenList.emplace_back( getTerminalID() );
+        }
+        if( _node_flags[ node ] & FROM_SOURCE ) {
+            adjacency.parentsList.emplace_back( getSourceID() );
+        }
+        for( auto i = _in_offsets[ v ]; i < _in_offsets[ v + 1 ]; i++ ) {
+            auto type = _edge_types[ _in_edges[ i ] ];
+            if( type == EdgeType::TREE ) {
+                adjacency.parentsList.emplace_back( duplicate ? getDuplicateID( _in_sources[ i ] ) : _in_sources[ i ] );
+            } else if( type == EdgeType::BACK && duplicate ) {
+                adjacency.parentsList.emplace_back( _in_sources[ i ] );
+            }
+        }
+    }
+    return adjacency;
+}
+
+/**
+ * Gets a cursor over the children of a node (for iterating without allocating)
+ * @param node Local DAG ID
+ * @return Cursor on the first child
+ */
+sbp::graph::ImplicitDAG::ChildCursor sbp::graph::ImplicitDAG::childCursor( const size_t &node ) const {
+    if( node == getSourceID() ) {
+        return ChildCursor( { node, 2 } );
+    }
+    if( node == getTerminalID() ) {
+        return ChildCursor( { node, 0 } );
+    }
+    return ChildCursor( { node, _out_offsets[ getOriginalID( node ) ] } );
+}
+
+/**
+ * Moves a cursor to the next child of its node
+ * @param cursor Child cursor
+ * @param child  Container for the local DAG ID of the child
+ * @return Child found (false when the cursor has gone past the last one)
+ */
+bool sbp::graph::ImplicitDAG::nextChild( ChildCursor &cursor, size_t &child ) const {
+    if( cursor._node == getSourceID() ) {
+        while( cursor._position < nodeCount() ) {
+            auto v = cursor._position++;
+            if( _node_flags[ v ] & FROM_SOURCE ) {
+                child = v;
+                return true;
+            }
+        }
+        return false;
+    }
+    if( cursor._node == getTerminalID() ) {
+        return false;
+    }
+    auto duplicate = isDuplicate( cursor._node );
+    auto end       = _out_offsets[ getOriginalID( cursor._node ) + 1 ];
+    while( cursor._position < end ) {
+        auto e = cursor._position++;
+        if( _edge_types[ e ] == EdgeType::TREE ) {
+            child = duplicate ? getDuplicateID( _out_targets[ e ] ) : _out_targets[ e ];
+            return true;
+        } else if( _edge_types[ e ] == EdgeType::BACK && !duplicate ) {
+            child = getDuplicateID( _out_targets[ e ] );
+            return true;
+        }
+    }
+    if( cursor._position == end ) { //r' comes last
+        cursor._position++;
+        if( _node_flags[ cursor._node ] & TO_TERMINAL ) {
+            child = getTerminalID();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Gets the local source node ID of the DAG (r)
+ * @return Source ID r
+ */
+size_t sbp::graph::ImplicitDAG::getSourceID() const {
+    return 0;
+}
+
+/**
+ * Gets the local terminal node ID of the DAG (r')
+ * @return Terminal ID r'
+ */
+size_t sbp::graph::ImplicitDAG::getTerminalID() const {
+    return 1;
+}
+
+/**
+ * Gets the ID of the duplicate of a node
+ * @param node Local DAG ID of an original node
+ * @return Local DAG ID of the duplicate
+ */
+size_t sbp::graph::ImplicitDAG::getDuplicateID( const size_t &node ) const {
+    return node + _unique_node_count - 2;
+}
+
+/**
+ * Checks if a node is a duplicate
+ * @param node Local DAG ID
+ * @return Duplicate state
+ */
+bool sbp::graph::ImplicitDAG::isDuplicate( const size_t &node ) const {
+    return node >= _unique_node_count;
+}
+
+/**
+ * Checks if a node's copy is missing some of the children its node has in the SubGraph
+ * (edges to r' are only on the duplicates and back edges only leave the originals)
+ * Only the SubGraph's own edges to r' count: those added to close the DAG of an SCC with no
+ * edge out of it have no equivalent in the graph.
+ * @param node Local DAG ID
+ * @return Missing children state (false for r/r')
+ */
+bool sbp::graph::ImplicitDAG::hasMissingChildren( const size_t &node ) const {
+    if( node == getSourceID() || node == getTerminalID() ) {
+        return false;
+    }
+    auto duplicate = isDuplicate( node );
+    auto v         = getOriginalID( node );
+    for( auto e = _out_offsets[ v ]; e < _out_offsets[ v + 1 ]; e++ ) {
+        if( duplicate ? _edge_types[ e ] == EdgeType::BACK : _out_targets[ e ] == getTerminalID() ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Checks if a node's copy is missing some of the parents its node has in the SubGraph
+ * (edges from r are only on the originals and back edges only reach the duplicates)
+ * Only the SubGraph's own edges from r count: those added to open the DAG of an SCC with no
+ * edge into it have no equivalent in the graph.
+ * @param node Local DAG ID
+ * @return Missing parents state (false for r/r')
+ */
+bool sbp::graph::ImplicitDAG::hasMissingParents( const size_t &node ) const {
+    if( node == getSourceID() || node == getTerminalID() ) {
+        return false;
+    }
+    auto duplicate = isDuplicate( node );
+    auto v         = getOriginalID( node );
+    for( auto i = _in_offsets[ v ]; i < _in_offsets[ v + 1 ]; i++ ) {
+        if( duplicate ? _in_sources[ i ] == getSourceID() : _edge_types[ _in_edges[ i ] ] == EdgeType::BACK ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Gets the global ID (i.e. the local SubGraph ID) of a node
+ * @param local Local DAG ID
+ * @return Global ID
+ * @throws std::out_of_range when local id passed is not in global graph (r/r'/invalid node)
+ */
+size_t sbp::graph::ImplicitDAG::getGlobalID( const size_t local ) const {
+    if( local < 2 || local >= nodeCount() ) {
+        LOG_ERROR( "[sbp::graph::ImplicitDAG::getGlobalID( ", local, " )] ID not mapped to the global graph." );
+        throw std::out_of_range( "Local ID has no global equivalent." );
+    }
+    return getOriginalID( local );
+}
+
+/**
+ * Gets the number of nodes in the DAG (including r, r' and the duplicates)
+ * @return Node count
+ */
+size_t sbp::graph::ImplicitDAG::nodeCount() const {
+    return _unique_node_count < 2 ? _unique_node_count : 2 * _unique_node_count - 2;
+}
+
+/**
+ * Gets the number of non-duplicated nodes
+ * @return Unique node counts
+ */
+size_t sbp::graph::ImplicitDAG::getUniqueNodeCount() const {
+    return _unique_node_count;
+}
+
+/**
+ * Gets the number of edges coming into a node
+ * @param node Local DAG ID
+ * @return In degree of the node
+ */
+size_t sbp::graph::ImplicitDAG::getInDegree( const size_t &node ) const {
+    if( node == getSourceID() ) {
+        return 0;
+    }
+    if( node == getTerminalID() ) {
+        return at( node ).parentsList.size();
+    }
+    size_t degree    = ( _node_flags[ node ] & FROM_SOURCE ) ? 1 : 0;
+    auto   duplicate = isDuplicate( node );
+    auto   v         = getOriginalID( node );
+    for( auto i = _in_offsets[ v ]; i < _in_offsets[ v + 1 ]; i++ ) {
+        auto type = _edge_types[ _in_edges[ i ] ];
+        if( type == EdgeType::TREE || ( type == EdgeType::BACK && duplicate ) ) {
+            degree++;
+        }
+    }
+    return degree;
+}
+
+/**
+ * Gets the number of edges going out of a node
+ * @param node Local DAG ID
+ * @return Out degree of the node
+ */
+size_t sbp::graph::ImplicitDAG::getOutDegree( const size_t &node ) const {
+    if( node == getTerminalID() ) {
+        return 0;
+    }
+    if( node == getSourceID() ) {
+        return at( node ).childrenList.size();
+    }
+    size_t degree    = ( _node_flags[ node ] & TO_TERMINAL ) ? 1 : 0;
+    auto   duplicate = isDuplicate( node );
+    auto   v         = getOriginalID( node );
+    for( auto e = _out_offsets[ v ]; e < _out_offsets[ v + 1 ]; e++ ) {
+        if( _edge_types[ e ] == EdgeType::TREE || ( _edge_types[ e ] == EdgeType::BACK && !duplicate ) ) {
+            degree++;
+        }
+    }
+    return degree;
+}
+
+/**
+ * Gets the name of the DAG
+ * @return Name
+ */
+std::string sbp::graph::ImplicitDAG::getName() const {
+    return _name;
+}
+
+/**
+ * Gets the original of a node
+ * @param node Local DAG ID (original or duplicate)
+ * @return Local DAG ID of the original (same as its local SubGraph ID)
+ */
+size_t sbp::graph::ImplicitDAG::getOriginalID( const size_t &node ) const {
+    return isDuplicate( node ) ? node - _unique_node_count + 2 : node;
+}
@@ -0,0 +1,91 @@
+/**
+    @class          sbp::graph::ImplicitDAG
+    @brief          Directed Acyclic Graph derived from a SubGraph and the DFS class of its edges
+
+    Same local ID layout as sbp::graph::DAG (r = 0, r' = 1, node v of the SubGraph as v and its
+    duplicate v' as v + n where n is the number of SubGraph nodes between r and r') but neither
+    the duplicates nor the edges are stored. The SubGraph's adjacency is kept in compact form
+    (forward and reverse offset arrays) with a 1 byte type per edge set during the DFS:
+        TREE (tree, forward or cross edge) u->v gives the DAG edges u->v and u'->v',
+        BACK (back edge)                   u->v gives the DAG edge u->v'.
+    Edges from r and to r' are kept as per-node flags.
+
+    @dependencies   sbp::graph::DAG
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_IMPLICITDAG_H
+#define SUPERBUBBLE_PERFORMANCE_IMPLICITDAG_H
+
+#include <cstdint>
+#include <vector>
+#include "DAG.h"
+
+namespace sbp {
+    namespace graph {
+        class ImplicitDAG {
+          public:
+            enum class EdgeType : uint8_t {
+                NONE, //not part of the DAG
+                TREE, //u->v and u'->v'
+                BACK  //u->v'
+            };
+            struct Node {
+                std::vector<size_t> childrenList;
+                std::vector<size_t> parentsList;
+            };
+            struct ChildCursor {
+                size_t _node;
+                size_t _position;
+            };
+            ImplicitDAG( const std::string &name,
+                         std::vector<size_t> &&offsets,
+                         std::vector<size_t> &&targets );
+            ~ImplicitDAG();
+            //SubGraph adjacency (local SubGraph IDs)
+            size_t edgesBegin( const size_t &sg_node ) const;
+            size_t edgesEnd( const size_t &sg_node ) const;
+            size_t getEdgeTarget( const size_t &edge ) const;
+            //Manipulation
+            void setEdgeType( const size_t &edge, const EdgeType &type );
+            void linkToSource( const size_t &node );
+            void linkToTerminal( const size_t &node );
+            void materialise( DAG &dag ) const;
+            //Access
+            EdgeType getEdgeType( const size_t &edge ) const;
+            Node at( const size_t &node ) const;
+            ChildCursor childCursor( const size_t &node ) const;
+            bool nextChild( ChildCursor &cursor, size_t &child ) const;
+            size_t getSourceID() const;
+            size_t getTerminalID() const;
+            size_t getDuplicateID( const size_t &node ) const;
+            size_t getOriginalID( const size_t &node ) const;
+            bool isDuplicate( const size_t &node ) const;
+            bool hasMissingChildren( const size_t &node ) const;
+            bool hasMissingParents( const size_t &node ) const;
+            //Translation
+            size_t getGlobalID( const size_t local ) const;
+            //State
+            size_t nodeCount() const;
+            size_t getUniqueNodeCount() const;
+            size_t getInDegree( const size_t &node ) const;
+            size_t getOutDegree( const size_t &node ) const;
+            std::string getName() const;
+
+          private:
+            enum NodeFlags : uint8_t {
+                FROM_SOURCE = 0x1, //r->v
+                TO_TERMINAL = 0x2  //v->r'
+            };
+            std::string           _name;
+            size_t                _unique_node_count; //SubGraph node count (with r and r')
+            std::vector<size_t>   _out_offsets;
+            std::vector<size_t>   _out_targets;
+            std::vector<size_t>   _in_offsets;
+            std::vector<size_t>   _in_edges;         //forward edge index of in-coming edges
+            std::vector<size_t>   _in_sources;
+            std::vector<EdgeType> _edge_types;
+            std::vector<uint8_t>  _node_flags;       //per DAG node
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_IMPLICITDAG_H
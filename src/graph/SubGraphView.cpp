@@ -0,0 +1,194 @@
+#include "SubGraphView.h"
+
+constexpr size_t sbp::graph::SubGraphView::NONE;
+
+/**
+ * Constructor
+ * @param name            Name of the sub-graph
+ * @param base_graph      Base graph (global) the SCC is in
+ * @param membership      Membership and local ID arrays of the partitioning
+ * @param scc_index       Index of the SCC in the membership array
+ * @param nodes           Global IDs of the SCC's nodes in local ID order
+ * @param singletons_flag Flag for when the SCC is the concatenated list of singleton SCCs
+ */
+sbp::graph::SubGraphView::SubGraphView( const std::string &name,
+                                        const eadlib::WeightedGraph<size_t> &base_graph,
+                                        std::shared_ptr<const Membership> membership,
+                                        const size_t &scc_index,
+                                        std::vector<size_t> &&nodes,
+                                        const bool &singletons_flag ) :
+    _name( name ),
+    _base_graph( base_graph ),
+    _membership( std::move( membership ) ),
+    _scc_index( scc_index ),
+    _nodes( std::move( nodes ) ),
+    _singletons( singletons_flag )
+{}
+
+/**
+ * Destructor
+ */
+sbp::graph::SubGraphView::~SubGraphView() {}
+
+/**
+ * Gets the adjacency of a node (derived from the base graph)
+ * @param local Local ID of the node
+ * @return Node with the local IDs of its children and parents
+ * @throws std::out_of_range when the local ID is not in the SubGraph
+ */
+sbp::graph::SubGraphView::Node sbp::graph::SubGraphView::at( const size_t &local ) const {
+    auto node = Node();
+    if( local == getSourceID() ) {
+        for( size_t i = 0; i < _nodes.size(); i++ ) {
+            if( hasOutsideParent( _nodes[ i ] ) ) {
+                node.childrenList.emplace_back( i + 2 );
+            }
+        }
+    } else if( local == getTerminalID() ) {
+        for( size_t i = 0; i < _nodes.size(); i++ ) {
+            if( hasOutsideChild( _nodes[ i ] ) ) {
+                node.parentsList.emplace_back( i + 2 );
+            }
+        }
+    } else {
+        const auto &base_node = _base_graph.at( getGlobalID( local ) );
+        for( auto u : base_node.childrenList ) {
+            if( isMember( u ) ) {
+                node.childrenList.emplace_back( _membership->_local_id[ u ] );
+            }
+        }
+        if( hasOutsideChild( getGlobalID( local ) ) ) {
+            node.childrenList.emplace_back( getTerminalID() );
+        }
+        for( auto u : base_node.parentsList ) {
+            if( isMember( u ) ) {
+                node.parentsList.emplace_back( _membership->_local_id[ u ] );
+            }
+        }
+        if( hasOutsideParent( getGlobalID( local ) ) ) {
+            node.parentsList.emplace_back( getSourceID() );
+        }
+    }
+    return node;
+}
+
+/**
+ * Gets the local source node ID of the subgraph (r)
+ * @return Source ID r
+ */
+size_t sbp::graph::SubGraphView::getSourceID() const {
+    return 0;
+}
+
+/**
+ * Gets the local terminal node ID of the subgraph (r')
+ * @return Terminal ID r'
+ */
+size_t sbp::graph::SubGraphView::getTerminalID() const {
+    return 1;
+}
+
+/**
+ * Gets the global ID from a local one
+ * @param local Local ID
+ * @return Global ID
+ * @throws std::out_of_range when local id passed is not in global graph (r/r'/invalid node)
+ */
+size_t sbp::graph::SubGraphView::getGlobalID( const size_t local ) const {
+    if( local < 2 ) {
+        throw std::out_of_range( "Local ID has no global equivalent." );
+    }
+    return _nodes.at( local - 2 );
+}
+
+/**
+ * Gets the local ID from a global one
+ * @param global Global ID
+ * @return Local ID
+ * @throws std::out_of_range when global id passed is not in local graph (invalid node)
+ */
+size_t sbp::graph::SubGraphView::getLocalID( const size_t global ) const {
+    if( !isMember( global ) ) {
+        throw std::out_of_range( "Global ID is not in the SubGraph." );
+    }
+    return _membership->_local_id[ global ];
+}
+
+/**
+ * Gets the number of nodes in the SubGraph (including r and r')
+ * @return Node count
+ */
+size_t sbp::graph::SubGraphView::nodeCount() const {
+    return _nodes.size() + 2;
+}
+
+/**
+ * Gets the number of edges coming into a node
+ * @param local Local ID of the node
+ * @return In degree of the node
+ */
+size_t sbp::graph::SubGraphView::getInDegree( const size_t &local ) const {
+    return at( local ).parentsList.size();
+}
+
+/**
+ * Gets the number of edges going out of a node
+ * @param local Local ID of the node
+ * @return Out degree of the node
+ */
+size_t sbp::graph::SubGraphView::getOutDegree( const size_t &local ) const {
+    return at( local ).childrenList.size();
+}
+
+/**
+ * Gets the name of the SubGraph
+ * @return Name
+ */
+std::string sbp::graph::SubGraphView::getName() const {
+    return _name;
+}
+
+/**
+ * Checks a node of the base graph is in the SubGraph
+ * @param global Global ID
+ * @return Membership state
+ */
+bool sbp::graph::SubGraphView::isMember( const size_t &global ) const {
+    return global < _membership->_scc.size() && _membership->_scc[ global ] == _scc_index;
+}
+
+/**
+ * Checks if a node has an edge leaving the SubGraph (i.e. an edge v->r')
+ * @param global Global ID of a node in the SubGraph
+ * @return Outside child state
+ */
+bool sbp::graph::SubGraphView::hasOutsideChild( const size_t &global ) const {
+    const auto &children = _base_graph.at( global ).childrenList;
+    if( _singletons && children.empty() ) {
+        return true;
+    }
+    for( auto u : children ) {
+        if( !isMember( u ) ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Checks if a node has an edge coming into the SubGraph (i.e. an edge r->v)
+ * @param global Global ID of a node in the SubGraph
+ * @return Outside parent state
+ */
+bool sbp::graph::SubGraphView::hasOutsideParent( const size_t &global ) const {
+    const auto &parents = _base_graph.at( global ).parentsList;
+    if( _singletons && parents.empty() ) {
+        return true;
+    }
+    for( auto u : parents ) {
+        if( !isMember( u ) ) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,69 @@
+/**
+    @class          sbp::graph::SubGraphView
+    @brief          Read-only SubGraph over the nodes of an SCC in the base graph
+
+    Same node layout as sbp::graph::SubGraph (r = 0, r' = 1 and the n-th node of the SCC
+    as local ID 2+n) but no adjacency is copied: the edges of a node are derived from the
+    base graph on access through a membership array (global ID -> SCC index) and a local ID
+    array (global ID -> local ID in its SCC) shared by all the views of a partitioning.
+    Edges leaving the SCC become v->r' and edges coming into it r->v. For the concatenated
+    singleton SCCs nodes with no children/parents in the base graph are linked to r'/r too.
+
+    @dependencies   eadlib::WeightedGraph<T>
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_SUBGRAPHVIEW_H
+#define SUPERBUBBLE_PERFORMANCE_SUBGRAPHVIEW_H
+
+#include <limits>
+#include <memory>
+#include <vector>
+#include <eadlib/datastructure/WeightedGraph.h>
+
+namespace sbp {
+    namespace graph {
+        class SubGraphView {
+          public:
+            static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+            struct Membership {
+                std::vector<size_t> _scc;      //global ID -> SCC index
+                std::vector<size_t> _local_id; //global ID -> local ID in its SCC
+            };
+            struct Node {
+                std::vector<size_t> childrenList;
+                std::vector<size_t> parentsList;
+            };
+            SubGraphView( const std::string &name,
+                          const eadlib::WeightedGraph<size_t> &base_graph,
+                          std::shared_ptr<const Membership> membership,
+                          const size_t &scc_index,
+                          std::vector<size_t> &&nodes,
+                          const bool &singletons_flag );
+            ~SubGraphView();
+            //Access
+            Node at( const size_t &local ) const;
+            size_t getSourceID() const;
+            size_t getTerminalID() const;
+            //Translation
+            size_t getGlobalID( const size_t local ) const;
+            size_t getLocalID( const size_t global ) const;
+            //State
+            size_t nodeCount() const;
+            size_t getInDegree( const size_t &local ) const;
+            size_t getOutDegree( const size_t &local ) const;
+            std::string getName() const;
+
+          private:
+            bool isMember( const size_t &global ) const;
+            bool hasOutsideChild( const size_t &global ) const;
+            bool hasOutsideParent( const size_t &global ) const;
+            std::string                          _name;
+            const eadlib::WeightedGraph<size_t> &_base_graph;
+            std::shared_ptr<const Membership>    _membership;
+            size_t                               _scc_index;
+            std::vector<size_t>                  _nodes;      //local ID - 2 -> global ID
+            bool                                 _singletons; //concatenated singleton SCCs
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_SUBGRAPHVIEW_H
@@ -0,0 +1,144 @@
+#include "AdjacencyCodec.h"
+
+#include <algorithm>
+
+/**
+ * Encodes the children of a node into a delta/varint BLOB
+ * @param node     Node ID
+ * @param children Children of the node (gets sorted by child ID)
+ * @param blob     Container for the encoded BLOB (appended to)
+ */
+void sbp::io::AdjacencyCodec::encodeChildren( const uint64_t &node, Children_t &children, std::string &blob ) {
+    std::sort( children.begin(), children.end() );
+    writeVarint( children.size(), blob );
+    int64_t previous = static_cast<int64_t>( node );
+    for( const auto &child : children ) {
+        int64_t delta = static_cast<int64_t>( child.first ) - previous;
+        writeVarint( ( static_cast<uint64_t>( delta ) << 1 ) ^ static_cast<uint64_t>( delta >> 63 ), blob ); //zigzag
+        writeVarint( child.second, blob );
+        previous = static_cast<int64_t>( child.first );
+    }
+}
+
+/**
+ * Decodes a children BLOB
+ * @param node     Node ID the BLOB belongs to
+ * @param data     BLOB data
+ * @param size     BLOB size in bytes
+ * @param children Container for the decoded children (cleared first)
+ * @return Success
+ */
+bool sbp::io::AdjacencyCodec::decodeChildren( const uint64_t &node,
+                                              const unsigned char *data,
+                                              const size_t &size,
+                                              Children_t &children ) {
+    children.clear();
+    size_t   position { 0 };
+    uint64_t count    { 0 };
+    if( !readVarint( data, size, position, count ) ) {
+        return false;
+    }
+    children.reserve( count );
+    int64_t previous = static_cast<int64_t>( node );
+    for( uint64_t i = 0; i < count; i++ ) {
+        uint64_t zigzag { 0 };
+        uint64_t weight { 0 };
+        if( !readVarint( data, size, position, zigzag ) || !readVarint( data, size, position, weight ) ) {
+            return false;
+        }
+        int64_t delta = static_cast<int64_t>( zigzag >> 1 ) ^ -static_cast<int64_t>( zigzag & 1 );
+        previous += delta;
+        children.emplace_back( static_cast<uint64_t>( previous ), weight );
+    }
+    return position == size;
+}
+
+/**
+ * Packs a K-mer into a 2-bit per base BLOB
+ * @param kmer K-mer string
+ * @param blob Container for the packed K-mer (replaced)
+ * @return Success (false when the K-mer contains anything other than 'A', 'C', 'G' or 'T')
+ */
+bool sbp::io::AdjacencyCodec::packKmer( const std::string &kmer, std::string &blob ) {
+    blob.clear();
+    writeVarint( kmer.size(), blob );
+    unsigned char byte { 0 };
+    for( size_t i = 0; i < kmer.size(); i++ ) {
+        unsigned char code { 0 };
+        switch( kmer[ i ] ) {
+            case 'A': code = 0; break;
+            case 'C': code = 1; break;
+            case 'G': code = 2; break;
+            case 'T': code = 3; break;
+            default:
+                blob.clear();
+                return false;
+        }
+        byte |= code << ( ( i % 4 ) * 2 );
+        if( i % 4 == 3 ) {
+            blob.push_back( static_cast<char>( byte ) );
+            byte = 0;
+        }
+    }
+    if( kmer.size() % 4 != 0 ) {
+        blob.push_back( static_cast<char>( byte ) );
+    }
+    return true;
+}
+
+/**
+ * Unpacks a 2-bit per base K-mer BLOB
+ * @param data BLOB data
+ * @param size BLOB size in bytes
+ * @param kmer Container for the K-mer string (replaced)
+ * @return Success
+ */
+bool sbp::io::AdjacencyCodec::unpackKmer( const unsigned char *data, const size_t &size, std::string &kmer ) {
+    static const char bases[4] = { 'A', 'C', 'G', 'T' };
+    size_t   position { 0 };
+    uint64_t length   { 0 };
+    if( !readVarint( data, size, position, length ) || size - position != ( length + 3 ) / 4 ) {
+        return false;
+    }
+    kmer.resize( length );
+    for( size_t i = 0; i < length; i++ ) {
+        kmer[ i ] = bases[ ( data[ position + i / 4 ] >> ( ( i % 4 ) * 2 ) ) & 0x3 ];
+    }
+    return true;
+}
+
+/**
+ * Appends an unsigned LEB128 varint
+ * @param value Value
+ * @param blob  BLOB to append to
+ */
+void sbp::io::AdjacencyCodec::writeVarint( uint64_t value, std::string &blob ) {
+    while( value >= 0x80 ) {
+        blob.push_back( static_cast<char>( ( value & 0x7F ) | 0x80 ) );
+        value >>= 7;
+    }
+    blob.push_back( static_cast<char>( value ) );
+}
+
+/**
+ * Reads an unsigned LEB128 varint
+ * @param data     BLOB data
+ * @param size     BLOB size in bytes
+ * @param position Read position (moved past the varint)
+ * @param value    Container for the value
+ * @return Success
+ */
+bool sbp::io::AdjacencyCodec::readVarint( const unsigned char *data, const size_t &size, size_t &position, uint64_t &value ) {
+    value = 0;
+    for( unsigned shift = 0; shift < 64; shift += 7 ) {
+        if( position >= size ) {
+            return false;
+        }
+        unsigned char byte = data[ position++ ];
+        value |= static_cast<uint64_t>( byte & 0x7F ) << shift;
+        if( !( byte & 0x80 ) ) {
+            return true;
+        }
+    }
+    return false;
+}
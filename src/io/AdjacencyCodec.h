@@ -0,0 +1,40 @@
+/**
+    @class          sbp::io::AdjacencyCodec
+    @brief          Compact binary encoding of node adjacencies and K-mers for DB storage
+
+                    Children BLOB:  varint(child count) then, for each child sorted by ID,
+                                    zigzag varint(child ID - previous ID) and varint(weight)
+                                    where 'previous ID' starts as the node's own ID.
+                    Packed K-mer:   varint(length) then 4 bases per byte, 2 bits each
+                                    (A=0, C=1, G=2, T=3), first base in the low bits.
+                                    Only upper-case ACGT strings can be packed.
+
+    @dependencies   none
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2017
+    @license        GNUv2 Public License
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_ADJACENCYCODEC_H
+#define SUPERBUBBLE_PERFORMANCE_ADJACENCYCODEC_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sbp {
+    namespace io {
+        class AdjacencyCodec {
+          public:
+            typedef std::vector<std::pair<uint64_t, uint64_t>> Children_t; //(child ID, edge weight)
+            static void encodeChildren( const uint64_t &node, Children_t &children, std::string &blob );
+            static bool decodeChildren( const uint64_t &node, const unsigned char *data, const size_t &size, Children_t &children );
+            static bool packKmer( const std::string &kmer, std::string &blob );
+            static bool unpackKmer( const unsigned char *data, const size_t &size, std::string &kmer );
+          private:
+            static void writeVarint( uint64_t value, std::string &blob );
+            static bool readVarint( const unsigned char *data, const size_t &size, size_t &position, uint64_t &value );
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_ADJACENCYCODEC_H
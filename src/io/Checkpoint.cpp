@@ -0,0 +1,542 @@
+#include "Checkpoint.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+    const char CHECKPOINT_MAGIC[8] = { 'S', 'B', 'P', 'C', 'H', 'K', 'P', 'T' };
+    const char * const STAGE_NAMES[5] = { "none", "graph", "scc", "subgraphs", "dags" };
+}
+
+constexpr uint32_t sbp::io::Checkpoint::VERSION;
+
+/**
+ * Constructor
+ * @param file_prefix Prefix of the checkpoint files (e.g.: graph name)
+ * @param fingerprint Fingerprint of the pipeline input the checkpoints are made from
+ */
+sbp::io::Checkpoint::Checkpoint( const std::string &file_prefix, const std::string &fingerprint ) :
+    _file_prefix( file_prefix ),
+    _fingerprint( fingerprint )
+{}
+
+/**
+ * Destructor
+ */
+sbp::io::Checkpoint::~Checkpoint() {}
+
+/**
+ * Checks if a stage has a checkpoint made from the current input
+ * @param stage Pipeline stage
+ * @return Valid state
+ */
+bool sbp::io::Checkpoint::isValid( const Stage &stage ) const {
+    std::string payload;
+    return read( stage, payload );
+}
+
+/**
+ * Gets the latest stage with a valid checkpoint
+ * @return Latest valid stage (NONE if there are none)
+ */
+sbp::io::Checkpoint::Stage sbp::io::Checkpoint::latest() const {
+    for( auto stage : { Stage::DAG_PACKAGES, Stage::SUB_GRAPHS, Stage::SCC_LIST, Stage::INDEX_GRAPH } ) {
+        if( isValid( stage ) ) {
+            return stage;
+        }
+    }
+    return Stage::NONE;
+}
+
+/**
+ * Gets the file name of a stage's checkpoint
+ * @param stage Pipeline stage
+ * @return File name
+ */
+std::string sbp::io::Checkpoint::getFileName( const Stage &stage ) const {
+    return _file_prefix + "." + STAGE_NAMES[ static_cast<size_t>( stage ) ] + ".ckpt";
+}
+
+/**
+ * Removes all the checkpoint files
+ */
+void sbp::io::Checkpoint::clear() const {
+    for( auto stage : { Stage::INDEX_GRAPH, Stage::SCC_LIST, Stage::SUB_GRAPHS, Stage::DAG_PACKAGES } ) {
+        std::remove( getFileName( stage ).c_str() );
+    }
+}
+
+/**
+ * Saves the indexed graph
+ * @param index_graph Index graph
+ * @param kmers       K-mer string of each node ID
+ * @return Success
+ */
+bool sbp::io::Checkpoint::save( const eadlib::WeightedGraph<size_t> &index_graph, const std::vector<std::string> &kmers ) const {
+    std::vector<size_t> nodes;
+    nodes.reserve( index_graph.nodeCount() );
+    for( const auto &node : index_graph ) {
+        nodes.emplace_back( node.first );
+    }
+    std::sort( nodes.begin(), nodes.end() );
+    std::string payload;
+    put( payload, index_graph.getName() );
+    put( payload, nodes.size() );
+    for( auto node : nodes ) {
+        put( payload, node );
+    }
+    for( auto node : nodes ) {
+        const auto &adjacency = index_graph.at( node );
+        put( payload, adjacency.childrenList.size() );
+        for( auto child : adjacency.childrenList ) {
+            put( payload, child );
+            put( payload, adjacency.weight.at( child ) );
+        }
+    }
+    put( payload, kmers.size() );
+    for( const auto &kmer : kmers ) {
+        put( payload, kmer );
+    }
+    return write( Stage::INDEX_GRAPH, payload );
+}
+
+/**
+ * Saves the SCCs found
+ * @param scc_list SCC list
+ * @return Success
+ */
+bool sbp::io::Checkpoint::save( const std::list<std::list<size_t>> &scc_list ) const {
+    std::string payload;
+    put( payload, scc_list.size() );
+    for( const auto &scc : scc_list ) {
+        put( payload, scc.size() );
+        for( auto node : scc ) {
+            put( payload, node );
+        }
+    }
+    return write( Stage::SCC_LIST, payload );
+}
+
+/**
+ * Saves the partitioned SubGraphs
+ * @param sub_graphs SubGraph list
+ * @return Success
+ */
+bool sbp::io::Checkpoint::save( const std::list<graph::SubGraph> &sub_graphs ) const {
+    std::string payload;
+    put( payload, sub_graphs.size() );
+    for( const auto &sub_graph : sub_graphs ) {
+        put( payload, sub_graph.getName() );
+        put( payload, sub_graph.nodeCount() );
+        for( size_t local = 2; local < sub_graph.nodeCount(); local++ ) { //r and r' have no global ID
+            put( payload, sub_graph.getGlobalID( local ) );
+        }
+        for( size_t local = 0; local < sub_graph.nodeCount(); local++ ) {
+            putChildren( payload, sub_graph, local );
+        }
+    }
+    return write( Stage::SUB_GRAPHS, payload );
+}
+
+/**
+ * Saves the DAG packages
+ * @param dag_packages DAG package list
+ * @return Success
+ */
+bool sbp::io::Checkpoint::save( const std::list<algo::GraphToDAG::DAG_Package> &dag_packages ) const {
+    std::string payload;
+    put( payload, dag_packages.size() );
+    for( const auto &package : dag_packages ) {
+        const auto &dag = package._dag;
+        auto unique_count = dag.getUniqueNodeCount() - 2;
+        put( payload, dag.getName() );
+        put( payload, static_cast<uint64_t>( dag.hasGraphSource() ) );
+        put( payload, static_cast<uint64_t>( dag.hasGraphTerminal() ) );
+        put( payload, unique_count );
+        for( size_t local = 2; local < unique_count + 2; local++ ) {
+            put( payload, dag.getGlobalID( local ) );
+        }
+        for( size_t local = 0; local < dag.nodeCount(); local++ ) {
+            putChildren( payload, dag, local );
+        }
+        put( payload, package._discovery_times.size() );
+        for( auto time : package._discovery_times ) {
+            put( payload, time );
+        }
+        for( auto time : package._finish_times ) {
+            put( payload, time );
+        }
+    }
+    return write( Stage::DAG_PACKAGES, payload );
+}
+
+/**
+ * Loads the indexed graph
+ * @param index_graph Index graph instance to load into
+ * @param kmers       Container for the K-mer string of each node ID
+ * @return Success
+ */
+bool sbp::io::Checkpoint::load( eadlib::WeightedGraph<size_t> &index_graph, std::vector<std::string> &kmers ) const {
+    if( !index_graph.isEmpty() ) {
+        LOG_ERROR( "[sbp::io::Checkpoint::load( <WeightedGraph<size_t>>, <kmers> )] WeightedGraph<size_t> instance not empty." );
+        return false;
+    }
+    std::string payload;
+    if( !read( Stage::INDEX_GRAPH, payload ) ) {
+        return false;
+    }
+    auto     reader = Reader( payload );
+    std::string name;
+    uint64_t node_count { 0 };
+    if( !reader.get( name ) || !reader.get( node_count ) ) {
+        return false;
+    }
+    std::vector<uint64_t> nodes( node_count );
+    for( auto &node : nodes ) {
+        if( !reader.get( node ) ) {
+            return false;
+        }
+        index_graph.addNode( node );
+    }
+    for( auto node : nodes ) {
+        uint64_t child_count { 0 };
+        if( !reader.get( child_count ) ) {
+            return false;
+        }
+        for( uint64_t i = 0; i < child_count; i++ ) {
+            uint64_t child { 0 }, weight { 0 };
+            if( !reader.get( child ) || !reader.get( weight ) || !index_graph.createDirectedEdge( node, child, weight ) ) {
+                return false;
+            }
+        }
+    }
+    uint64_t kmer_count { 0 };
+    if( !reader.get( kmer_count ) ) {
+        return false;
+    }
+    kmers.clear();
+    kmers.reserve( kmer_count );
+    for( uint64_t i = 0; i < kmer_count; i++ ) {
+        kmers.emplace_back();
+        if( !reader.get( kmers.back() ) ) {
+            return false;
+        }
+    }
+    index_graph.setName( name );
+    return reader.done();
+}
+
+/**
+ * Loads the SCCs
+ * @param scc_list SCC list container to load into
+ * @return Success
+ */
+bool sbp::io::Checkpoint::load( std::list<std::list<size_t>> &scc_list ) const {
+    std::string payload;
+    if( !read( Stage::SCC_LIST, payload ) ) {
+        return false;
+    }
+    auto     reader = Reader( payload );
+    uint64_t scc_count { 0 };
+    if( !reader.get( scc_count ) ) {
+        return false;
+    }
+    for( uint64_t i = 0; i < scc_count; i++ ) {
+        uint64_t size { 0 };
+        if( !reader.get( size ) ) {
+            return false;
+        }
+        auto scc = scc_list.emplace( scc_list.end(), std::list<size_t>() );
+        for( uint64_t j = 0; j < size; j++ ) {
+            uint64_t node { 0 };
+            if( !reader.get( node ) ) {
+                return false;
+            }
+            scc->emplace_back( node );
+        }
+    }
+    return reader.done();
+}
+
+/**
+ * Loads the partitioned SubGraphs
+ * @param sub_graphs SubGraph list container to load into
+ * @return Success
+ */
+bool sbp::io::Checkpoint::load( std::list<graph::SubGraph> &sub_graphs ) const {
+    std::string payload;
+    if( !read( Stage::SUB_GRAPHS, payload ) ) {
+        return false;
+    }
+    auto     reader = Reader( payload );
+    uint64_t sub_graph_count { 0 };
+    if( !reader.get( sub_graph_count ) ) {
+        return false;
+    }
+    for( uint64_t i = 0; i < sub_graph_count; i++ ) {
+        std::string name;
+        uint64_t    node_count { 0 };
+        if( !reader.get( name ) || !reader.get( node_count ) || node_count < 2 ) {
+            return false;
+        }
+        auto sub_graph = sub_graphs.emplace( sub_graphs.end(), graph::SubGraph( name ) );
+        for( uint64_t local = 2; local < node_count; local++ ) {
+            uint64_t global { 0 };
+            if( !reader.get( global ) ) {
+                return false;
+            }
+            sub_graph->addNode( global );
+        }
+        for( uint64_t local = 0; local < node_count; local++ ) {
+            if( !getChildren( reader, *sub_graph, local ) ) {
+                return false;
+            }
+        }
+    }
+    return reader.done();
+}
+
+/**
+ * Loads the DAG packages
+ * @param dag_packages DAG package list container to load into
+ * @return Success
+ */
+bool sbp::io::Checkpoint::load( std::list<algo::GraphToDAG::DAG_Package> &dag_packages ) const {
+    std::string payload;
+    if( !read( Stage::DAG_PACKAGES, payload ) ) {
+        return false;
+    }
+    auto     reader = Reader( payload );
+    uint64_t package_count { 0 };
+    if( !reader.get( package_count ) ) {
+        return false;
+    }
+    for( uint64_t i = 0; i < package_count; i++ ) {
+        std::string name;
+        uint64_t    graph_source { 0 };
+        uint64_t    graph_terminal { 0 };
+        uint64_t    unique_count { 0 };
+        if( !reader.get( name ) || !reader.get( graph_source ) || !reader.get( graph_terminal ) || !reader.get( unique_count ) ) {
+            return false;
+        }
+        std::vector<size_t> global_ids( unique_count );
+        for( auto &global : global_ids ) {
+            uint64_t value { 0 };
+            if( !reader.get( value ) ) {
+                return false;
+            }
+            global = value;
+        }
+        auto package = dag_packages.emplace( dag_packages.end(), algo::GraphToDAG::DAG_Package( name, 0 ) );
+        package->_dag.addNodes( global_ids );
+        package->_dag.setGraphLinks( graph_source != 0, graph_terminal != 0 );
+        for( size_t local = 0; local < package->_dag.nodeCount(); local++ ) {
+            if( !getChildren( reader, package->_dag, local ) ) {
+                return false;
+            }
+        }
+        uint64_t time_count { 0 };
+        if( !reader.get( time_count ) ) {
+            return false;
+        }
+        package->_discovery_times.resize( time_count );
+        package->_finish_times.resize( time_count );
+        for( auto &time : package->_discovery_times ) {
+            uint64_t value { 0 };
+            if( !reader.get( value ) ) {
+                return false;
+            }
+            time = value;
+        }
+        for( auto &time : package->_finish_times ) {
+            uint64_t value { 0 };
+            if( !reader.get( value ) ) {
+                return false;
+            }
+            time = value;
+        }
+    }
+    return reader.done();
+}
+
+/**
+ * Reader constructor
+ * @param payload Payload to read from
+ */
+sbp::io::Checkpoint::Reader::Reader( const std::string &payload ) :
+    _payload( payload ),
+    _position( 0 )
+{}
+
+/**
+ * Reads the next value of the payload
+ * @param value Value container
+ * @return Success (false when the payload is too short)
+ */
+bool sbp::io::Checkpoint::Reader::get( uint64_t &value ) {
+    if( _payload.size() - _position < sizeof( uint64_t ) ) {
+        return false;
+    }
+    std::char_traits<char>::copy( reinterpret_cast<char *>( &value ), _payload.data() + _position, sizeof( uint64_t ) );
+    _position += sizeof( uint64_t );
+    return true;
+}
+
+/**
+ * Reads the next length-prefixed string of the payload
+ * @param value String container
+ * @return Success (false when the payload is too short)
+ */
+bool sbp::io::Checkpoint::Reader::get( std::string &value ) {
+    uint64_t length { 0 };
+    if( !get( length ) || _payload.size() - _position < length ) {
+        return false;
+    }
+    value.assign( _payload, _position, length );
+    _position += length;
+    return true;
+}
+
+/**
+ * Checks if the whole payload has been read
+ * @return Done state
+ */
+bool sbp::io::Checkpoint::Reader::done() const {
+    return _position == _payload.size();
+}
+
+/**
+ * Appends a value to a payload
+ * @param payload Payload
+ * @param value   Value
+ */
+void sbp::io::Checkpoint::put( std::string &payload, const uint64_t &value ) {
+    payload.append( reinterpret_cast<const char *>( &value ), sizeof( uint64_t ) );
+}
+
+/**
+ * Appends a length-prefixed string to a payload
+ * @param payload Payload
+ * @param value   String
+ */
+void sbp::io::Checkpoint::put( std::string &payload, const std::string &value ) {
+    put( payload, value.size() );
+    payload.append( value );
+}
+
+/**
+ * Appends the children of a node to a payload (in children list order)
+ * @param payload Payload
+ * @param graph   Graph
+ * @param node    Node
+ */
+void sbp::io::Checkpoint::putChildren( std::string &payload, const eadlib::Graph<size_t> &graph, const size_t &node ) {
+    const auto &children = graph.at( node ).childrenList;
+    put( payload, children.size() );
+    for( auto child : children ) {
+        put( payload, child );
+    }
+}
+
+/**
+ * Reads the children of a node from a payload and creates the edges
+ * @param reader Payload reader
+ * @param graph  Graph (all nodes already added)
+ * @param node   Node
+ * @return Success
+ */
+bool sbp::io::Checkpoint::getChildren( Reader &reader, eadlib::Graph<size_t> &graph, const size_t &node ) {
+    uint64_t child_count { 0 };
+    if( !reader.get( child_count ) ) {
+        return false;
+    }
+    for( uint64_t i = 0; i < child_count; i++ ) {
+        uint64_t child { 0 };
+        if( !reader.get( child ) || !graph.createDirectedEdge( node, child ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Writes a stage's checkpoint file (through a temporary file renamed into place)
+ * @param stage   Pipeline stage
+ * @param payload Payload
+ * @return Success
+ */
+bool sbp::io::Checkpoint::write( const Stage &stage, const std::string &payload ) const {
+    if( _fingerprint.size() != sizeof( Header::_fingerprint ) ) {
+        LOG_ERROR( "[sbp::io::Checkpoint::write( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", <payload> )] Invalid input fingerprint '", _fingerprint, "'." );
+        return false;
+    }
+    Header header {};
+    std::char_traits<char>::copy( header._magic, CHECKPOINT_MAGIC, sizeof( CHECKPOINT_MAGIC ) );
+    std::char_traits<char>::copy( header._fingerprint, _fingerprint.data(), sizeof( header._fingerprint ) );
+    header._version      = VERSION;
+    header._stage        = static_cast<uint32_t>( stage );
+    header._payload_size = payload.size();
+    header._payload_hash = Fingerprint::hash( payload.data(), payload.size() );
+    auto file_name = getFileName( stage );
+    auto temp_name = file_name + ".tmp";
+    std::ofstream out( temp_name, std::ios::binary | std::ios::trunc );
+    if( !out.is_open() ) {
+        LOG_ERROR( "[sbp::io::Checkpoint::write( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", <payload> )] Could not open '", temp_name, "' for writing." );
+        return false;
+    }
+    out.write( reinterpret_cast<const char *>( &header ), sizeof( Header ) );
+    out.write( payload.data(), payload.size() );
+    out.close();
+    if( out.fail() || std::rename( temp_name.c_str(), file_name.c_str() ) != 0 ) {
+        LOG_ERROR( "[sbp::io::Checkpoint::write( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", <payload> )] Problem writing '", file_name, "'." );
+        std::remove( temp_name.c_str() );
+        return false;
+    }
+    LOG_DEBUG( "[sbp::io::Checkpoint::write( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", <payload> )] Checkpoint written (", payload.size(), " bytes)." );
+    return true;
+}
+
+/**
+ * Reads and validates a stage's checkpoint file
+ * @param stage   Pipeline stage
+ * @param payload Container for the payload
+ * @return Success (false when missing, made from another input or corrupted)
+ */
+bool sbp::io::Checkpoint::read( const Stage &stage, std::string &payload ) const {
+    auto file_name = getFileName( stage );
+    std::ifstream in( file_name, std::ios::binary | std::ios::ate );
+    if( !in.is_open() ) {
+        return false;
+    }
+    auto file_size = static_cast<uint64_t>( in.tellg() );
+    in.seekg( 0 );
+    Header header {};
+    if( file_size < sizeof( Header ) || !in.read( reinterpret_cast<char *>( &header ), sizeof( Header ) ) ) {
+        LOG_ERROR( "[sbp::io::Checkpoint::read( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", .. )] '", file_name, "' is too small to be a checkpoint." );
+        return false;
+    }
+    if( std::char_traits<char>::compare( header._magic, CHECKPOINT_MAGIC, sizeof( CHECKPOINT_MAGIC ) ) != 0
+        || header._version != VERSION
+        || header._stage != static_cast<uint32_t>( stage ) ) {
+        LOG_ERROR( "[sbp::io::Checkpoint::read( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", .. )] '", file_name, "' is not a supported checkpoint for this stage." );
+        return false;
+    }
+    if( _fingerprint.size() != sizeof( header._fingerprint )
+        || std::char_traits<char>::compare( header._fingerprint, _fingerprint.data(), sizeof( header._fingerprint ) ) != 0 ) {
+        LOG_WARNING( "[sbp::io::Checkpoint::read( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", .. )] '", file_name, "' was made from a different input." );
+        return false;
+    }
+    if( header._payload_size != file_size - sizeof( Header ) ) {
+        LOG_ERROR( "[sbp::io::Checkpoint::read( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", .. )] '", file_name, "' is truncated." );
+        return false;
+    }
+    payload.resize( header._payload_size );
+    if( !in.read( &payload[ 0 ], static_cast<std::streamsize>( payload.size() ) )
+        || Fingerprint::hash( payload.data(), payload.size() ) != header._payload_hash ) {
+        LOG_ERROR( "[sbp::io::Checkpoint::read( ", STAGE_NAMES[ static_cast<size_t>( stage ) ], ", .. )] '", file_name, "' is corrupted." );
+        payload.clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,97 @@
+/**
+    @class          sbp::io::Checkpoint
+    @brief          Persistent checkpoints of the pipeline stages
+
+                    Each stage result is written to its own file ('<prefix>.<stage>.ckpt'):
+                      Header   magic "SBPCHKPT", version, stage, input fingerprint (16 chars),
+                               payload size, FNV-1a hash of the payload
+                      Payload  stage result as uint64_t values and length-prefixed strings
+
+                    Files are written to a temporary file first and renamed into place
+                    so an interrupted write never leaves a checkpoint that looks valid.
+                    A checkpoint is only loaded when its fingerprint matches the one of
+                    the current input and its payload hash checks out.
+
+    @dependencies   eadlib::WeightedGraph<T>, eadlib::logger::Logger, sbp::io::Fingerprint,
+                    sbp::graph::SubGraph, sbp::algo::GraphToDAG
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2017
+    @license        GNUv2 Public License
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_CHECKPOINT_H
+#define SUPERBUBBLE_PERFORMANCE_CHECKPOINT_H
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+#include <eadlib/logger/Logger.h>
+#include <eadlib/datastructure/WeightedGraph.h>
+#include "Fingerprint.h"
+#include "../graph/SubGraph.h"
+#include "../algorithm/GraphToDAG.h"
+
+namespace sbp {
+    namespace io {
+        class Checkpoint {
+          public:
+            enum class Stage {
+                NONE         = 0,
+                INDEX_GRAPH  = 1, //Compressed graph as indexed + K-mer of each node ID
+                SCC_LIST     = 2, //Strongly connected components
+                SUB_GRAPHS   = 3, //Partitioned SubGraphs
+                DAG_PACKAGES = 4  //SubGraphs converted into DAGs
+            };
+            static constexpr uint32_t VERSION = 2;
+            Checkpoint( const std::string &file_prefix, const std::string &fingerprint );
+            ~Checkpoint();
+            //State
+            bool isValid( const Stage &stage ) const;
+            Stage latest() const;
+            std::string getFileName( const Stage &stage ) const;
+            void clear() const;
+            //Saving
+            bool save( const eadlib::WeightedGraph<size_t> &index_graph, const std::vector<std::string> &kmers ) const;
+            bool save( const std::list<std::list<size_t>> &scc_list ) const;
+            bool save( const std::list<graph::SubGraph> &sub_graphs ) const;
+            bool save( const std::list<algo::GraphToDAG::DAG_Package> &dag_packages ) const;
+            //Loading
+            bool load( eadlib::WeightedGraph<size_t> &index_graph, std::vector<std::string> &kmers ) const;
+            bool load( std::list<std::list<size_t>> &scc_list ) const;
+            bool load( std::list<graph::SubGraph> &sub_graphs ) const;
+            bool load( std::list<algo::GraphToDAG::DAG_Package> &dag_packages ) const;
+
+          private:
+            struct Header {
+                char     _magic[8];
+                uint32_t _version;
+                uint32_t _stage;
+                char     _fingerprint[16];
+                uint64_t _payload_size;
+                uint64_t _payload_hash;
+            };
+            //Payload serialisation
+            class Reader {
+              public:
+                Reader( const std::string &payload );
+                bool get( uint64_t &value );
+                bool get( std::string &value );
+                bool done() const;
+              private:
+                const std::string &_payload;
+                size_t             _position;
+            };
+            static void put( std::string &payload, const uint64_t &value );
+            static void put( std::string &payload, const std::string &value );
+            static void putChildren( std::string &payload, const eadlib::Graph<size_t> &graph, const size_t &node );
+            static bool getChildren( Reader &reader, eadlib::Graph<size_t> &graph, const size_t &node );
+            //File access
+            bool write( const Stage &stage, const std::string &payload ) const;
+            bool read( const Stage &stage, std::string &payload ) const;
+            std::string _file_prefix;
+            std::string _fingerprint;
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_CHECKPOINT_H
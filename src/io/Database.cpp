@@ -1,28 +1,48 @@
 #include <eadlib/cli/graphic/ProgressBar.h>
 #include "Database.h"
 
+constexpr size_t sbp::io::Database::LOOKUP_BATCH_ROWS;
+
 /**
  * Constructor
  * @param writer File Writer
  */
 sbp::io::Database::Database() :
     _database( eadlib::wrapper::SQLite() ),
-    _graph_name( "" )
-{}
+    _graph_name( "" ),
+    _read_only( false ),
+    _batch_graph_id( "" )
+{
+    _node_batch.reserve( NODE_BATCH_ROWS );
+    _edge_batch.reserve( EDGE_BATCH_ROWS );
+    _adjacency_batch.reserve( ADJACENCY_BATCH_ROWS );
+}
 
 /**
  * Move-Constructor
  * @param db Database instance to move over
  */
 sbp::io::Database::Database( sbp::io::Database &&db ) noexcept {
-    _database = std::move( db._database );
-    _graph_name = db._graph_name;
+    _database       = std::move( db._database );
+    _graph_name     = db._graph_name;
+    _read_only      = db._read_only;
+    _batch_graph_id = std::move( db._batch_graph_id );
+    _node_batch     = std::move( db._node_batch );
+    _edge_batch     = std::move( db._edge_batch );
+    _adjacency_batch  = std::move( db._adjacency_batch );
+    _node_insert      = std::move( db._node_insert );
+    _edge_insert      = std::move( db._edge_insert );
+    _adjacency_insert = std::move( db._adjacency_insert );
 }
 
 /**
  * Destructor
  */
-sbp::io::Database::~Database() {}
+sbp::io::Database::~Database() {
+    if( isOpen() ) {
+        flush();
+    }
+}
 
 /**
  * Move assignement operator
@@ -30,8 +50,16 @@ sbp::io::Database::~Database() {}
  * @return Moved database instance
  */
 sbp::io::Database & sbp::io::Database::operator =( sbp::io::Database &&rhs ) noexcept {
-    _database = std::move( rhs._database );
-    _graph_name = rhs._graph_name;
+    _database       = std::move( rhs._database );
+    _graph_name     = rhs._graph_name;
+    _read_only      = rhs._read_only;
+    _batch_graph_id = std::move( rhs._batch_graph_id );
+    _node_batch     = std::move( rhs._node_batch );
+    _edge_batch     = std::move( rhs._edge_batch );
+    _adjacency_batch  = std::move( rhs._adjacency_batch );
+    _node_insert      = std::move( rhs._node_insert );
+    _edge_insert      = std::move( rhs._edge_insert );
+    _adjacency_insert = std::move( rhs._adjacency_insert );
     return *this;
 }
 
@@ -44,24 +72,25 @@ bool sbp::io::Database::open( const std::string &file_name ) {
     if( !_database.open( file_name ) ) {
         LOG_ERROR( "[sbp::io::Database::open( ", file_name, " )] Could not open a connection to the database." );
         return false;
-    } else {
-        auto table = eadlib::TableDB();
-        std::string check_graph_table_query = { "SELECT name FROM sqlite_master WHERE type='table' AND name='Graphs' COLLATE NOCASE" };
-        if( _database.pull( check_graph_table_query, table ) == 0 ) {
-            std::string create_table_query { "CREATE TABLE Graphs("
-                                                 "GraphID INTEGER PRIMARY KEY, "
-                                                 "Name TEXT NOT NULL, "
-                                                 "CONSTRAINT unique_name UNIQUE( Name ));"
-            };
-            if( !_database.push( create_table_query ) ) {
-                LOG_ERROR( "[sbp::io::Database::open( ", file_name, " )] Problem creating 'Graphs' table in database." );
-                return false;
-            } else {
-                LOG_DEBUG( "[sbp::io::Database::open( ", file_name, " )] New DB detected. Created a 'Graphs' table." );
-            }
-        }
-        return true;
     }
+    _read_only = false;
+    return checkTables( file_name );
+}
+
+/**
+ * Opens a read-only connection to the database
+ * (kmer graphs are then loaded with an extra read-only connection reading the
+ *  kmers while the edges are read on this one - see loadGraph(..))
+ * @param file_name File name of database
+ * @return Success
+ */
+bool sbp::io::Database::openReadOnly( const std::string &file_name ) {
+    if( !_database.openReadOnly( file_name ) ) {
+        LOG_ERROR( "[sbp::io::Database::openReadOnly( ", file_name, " )] Could not open a read-only connection to the database." );
+        return false;
+    }
+    _read_only = true;
+    return true;
 }
 
 /**
@@ -69,6 +98,13 @@ bool sbp::io::Database::open( const std::string &file_name ) {
  * @return Success
  */
 bool sbp::io::Database::close() {
+    if( isOpen() && !flush() ) {
+        LOG_ERROR( "[sbp::io::Database::close()] Pending rows could not be written before closing." );
+    }
+    clearBatches();
+    finalizeInserts();
+    _read_only      = false;
+    _batch_graph_id = "";
     return _database.close();
 }
 
@@ -80,6 +116,14 @@ bool sbp::io::Database::isOpen() const {
     return _database.connected();
 }
 
+/**
+ * Checks if the connection is read-only
+ * @return Read-only state
+ */
+bool sbp::io::Database::isReadOnly() const {
+    return _read_only;
+}
+
 /**
  * Lists all the graphs stored in the database
  * @param out Output stream
@@ -102,9 +146,10 @@ std::ostream &sbp::io::Database::listGraphs( std::ostream &out ) {
 /**
  * Creates a table set for a new graph
  * @param graph_name Graph name
+ * @param schema     Storage layout to create the tables for
  * @return Success
  */
-bool sbp::io::Database::create( const std::string &graph_name ) {
+bool sbp::io::Database::create( const std::string &graph_name, const StorageSchema &schema ) {
     if( exists( graph_name ) ) {
         auto graph_id = getGraphID( graph_name );
         auto table = eadlib::TableDB();
@@ -129,6 +174,23 @@ bool sbp::io::Database::create( const std::string &graph_name ) {
             //remove( graph_name );
             return false;
         }
+        if( schema == StorageSchema::ADJACENCY_BLOB ) {
+            std::string create_adjacency_table_query { "CREATE TABLE adjacency_" + std::to_string( graph_id ) + "( "
+                                                                                                             "ID INTEGER PRIMARY KEY, "
+                                                                                                             "Kmer BLOB NOT NULL, "
+                                                                                                             "Children BLOB NOT NULL)"
+            };
+            if( !_database.push( create_adjacency_table_query ) ) {
+                LOG_ERROR( "[sbp::io::Database::create( ", graph_name, " )] Couldn't create Adjacency table 'adjacency_", graph_id, "'." );
+                return false;
+            }
+            if( !setMetadata( graph_name, "schema", "adjacency" ) ) {
+                LOG_ERROR( "[sbp::io::Database::create( ", graph_name, " )] Couldn't record the storage schema of the graph." );
+                return false;
+            }
+            LOG_DEBUG( "[sbp::io::Database::create( ", graph_name, " )] Adjacency table for graph (ID=", graph_id, ") created." );
+            return true;
+        }
         std::string create_kmer_table_query { "CREATE TABLE kmers_" + std::to_string( graph_id ) + "( "
                                                                                                  "ID INTEGER NOT NULL, "
                                                                                                  "Kmer TEXT NOT NULL, "
@@ -166,14 +228,31 @@ bool sbp::io::Database::remove( const std::string &graph_name ) {
     if( exists( graph_name ) ) {
         bool error_flag { false };
         auto graph_id = getGraphID( graph_name );
-        if( !_database.push( "DROP TABLE kmers_" + std::to_string( graph_id ) ) ) {
+        if( std::to_string( graph_id ) == _batch_graph_id ) { //drop pending rows and statements on the tables
+            clearBatches();
+            finalizeInserts();
+            _batch_graph_id = "";
+        }
+        if( !_database.push( "DROP TABLE IF EXISTS kmers_" + std::to_string( graph_id ) ) ) {
             LOG_ERROR( "sbp::io::Database::remove( ", graph_name, " )] Couldn't drop Kmer table 'kmers_", graph_id, "'." );
             error_flag = true;
         }
-        if( !_database.push( "DROP TABLE edges_" + std::to_string( graph_id ) ) ) {
+        if( !_database.push( "DROP TABLE IF EXISTS edges_" + std::to_string( graph_id ) ) ) {
             LOG_ERROR( "sbp::io::Database::remove( ", graph_name, " )] Couldn't drop Edges table 'edges_", graph_id, "'." );
             error_flag = true;
         }
+        if( !_database.push( "DROP TABLE IF EXISTS adjacency_" + std::to_string( graph_id ) ) ) {
+            LOG_ERROR( "sbp::io::Database::remove( ", graph_name, " )] Couldn't drop Adjacency table 'adjacency_", graph_id, "'." );
+            error_flag = true;
+        }
+        if( !_database.push( "DROP TABLE IF EXISTS kmerindex_" + std::to_string( graph_id ) ) ) {
+            LOG_ERROR( "sbp::io::Database::remove( ", graph_name, " )] Couldn't drop K-mer locator table 'kmerindex_", graph_id, "'." );
+            error_flag = true;
+        }
+        if( !_database.push( "DELETE FROM GraphMeta WHERE GraphID=" + std::to_string( graph_id ) ) ) {
+            LOG_ERROR( "sbp::io::Database::remove( ", graph_name, " )] Problem deleting entries in GraphMeta table." );
+            error_flag = true;
+        }
         if( !_database.push( "DELETE FROM Graphs WHERE Name='" + graph_name + "'" ) ) {
             LOG_ERROR( "sbp::io::Database::remove( ", graph_name, " )] Problem deleting entry in Graphs table." );
             error_flag = true;
@@ -203,40 +282,152 @@ std::string sbp::io::Database::getID( const std::string &graph_name ) {
     return std::to_string( getGraphID( graph_name ) );
 }
 
+/**
+ * Sets a metadata value for a graph (replaces any previous value for the key)
+ * @param graph_name Graph name
+ * @param key        Metadata key
+ * @param value      Metadata value
+ * @return Success
+ */
+bool sbp::io::Database::setMetadata( const std::string &graph_name, const std::string &key, const std::string &value ) {
+    auto graph_id = getGraphID( graph_name );
+    if( graph_id < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::setMetadata( ", graph_name, ", ", key, ", ", value, " )] Graph not found in DB." );
+        return false;
+    }
+    auto statement = eadlib::wrapper::SQLiteStatement();
+    if( !_database.prepare( "INSERT OR REPLACE INTO GraphMeta (GraphID, Key, Value) VALUES (?,?,?)", statement ) ) {
+        return false;
+    }
+    statement.bindInt( 1, graph_id );
+    statement.bindText( 2, key );
+    statement.bindText( 3, value );
+    return statement.execute();
+}
+
+/**
+ * Gets a metadata value for a graph
+ * @param graph_name Graph name
+ * @param key        Metadata key
+ * @return Metadata value (empty if not set)
+ */
+std::string sbp::io::Database::getMetadata( const std::string &graph_name, const std::string &key ) {
+    auto statement = eadlib::wrapper::SQLiteStatement();
+    std::string query { "SELECT Value FROM GraphMeta INNER JOIN Graphs ON GraphMeta.GraphID = Graphs.GraphID "
+                        "WHERE Graphs.Name = ? AND GraphMeta.Key = ?" };
+    if( !_database.prepare( query, statement ) ) {
+        return "";
+    }
+    statement.bindText( 1, graph_name );
+    statement.bindText( 2, key );
+    return statement.fetch() ? statement.getString( 0 ) : "";
+}
+
+/**
+ * Finds a graph by one of its metadata entries
+ * @param key   Metadata key
+ * @param value Metadata value to match
+ * @return Name of the first graph found with the key/value pair (empty if none)
+ */
+std::string sbp::io::Database::findGraph( const std::string &key, const std::string &value ) {
+    auto statement = eadlib::wrapper::SQLiteStatement();
+    std::string query { "SELECT Graphs.Name FROM GraphMeta INNER JOIN Graphs ON GraphMeta.GraphID = Graphs.GraphID "
+                        "WHERE GraphMeta.Key = ? AND GraphMeta.Value = ? ORDER BY Graphs.GraphID LIMIT 1" };
+    if( !_database.prepare( query, statement ) ) {
+        return "";
+    }
+    statement.bindText( 1, key );
+    statement.bindText( 2, value );
+    return statement.fetch() ? statement.getString( 0 ) : "";
+}
+
+/**
+ * Gets the storage layout used by a graph
+ * @param graph_name Graph name
+ * @return Storage schema (graphs without a recorded schema use edge rows)
+ */
+sbp::io::StorageSchema sbp::io::Database::getSchema( const std::string &graph_name ) {
+    return getMetadata( graph_name, "schema" ) == "adjacency" ? StorageSchema::ADJACENCY_BLOB
+                                                              : StorageSchema::EDGE_ROWS;
+}
+
 /**
  * Writes to the index table the node information
+ * (rows are buffered and inserted in batches - see flush())
  * @param graph_id Graph ID
  * @param index    Node index id
  * @param kmer     Node content
  * @return Success
  */
 bool sbp::io::Database::writeNode( const std::string &graph_id, const size_t &index, const std::string &kmer ) {
-    return _database.push( "INSERT INTO kmers_"
-                           + graph_id + " (ID, Kmer) VALUES ("
-                           + std::to_string( index )
-                           + ", '"
-                           + kmer
-                           + "');"
-    );
+    if( !switchBatchGraph( graph_id ) ) {
+        return false;
+    }
+    _node_batch.emplace_back( NodeRow { index, kmer } );
+    if( _node_batch.size() >= NODE_BATCH_ROWS ) {
+        return flushNodes();
+    }
+    return true;
 }
 
 /**
  * Writes to the edge table the edge
+ * (rows are buffered and inserted in batches - see flush())
  * @param graph_id Graph ID
  * @param from     Origin node id
  * @param to       Destination node id
+ * @param weight   Edge weight
  * @return Success
  */
 bool sbp::io::Database::writeEdge( const std::string &graph_id, const size_t &from, const size_t &to, const size_t &weight ) {
-    return _database.push( "INSERT INTO edges_"
-                           + graph_id + " (From_ID, To_ID, Weight) VALUES ("
-                           + std::to_string( from )
-                           + ", "
-                           + std::to_string( to )
-                           + ", "
-                           + std::to_string( weight )
-                           + ");"
-    );
+    if( !switchBatchGraph( graph_id ) ) {
+        return false;
+    }
+    _edge_batch.emplace_back( EdgeRow { from, to, weight } );
+    if( _edge_batch.size() >= EDGE_BATCH_ROWS ) {
+        return flushEdges();
+    }
+    return true;
+}
+
+/**
+ * Writes to the adjacency table a node along with its children
+ * (rows are buffered and inserted in batches - see flush())
+ * @param graph_id Graph ID
+ * @param index    Node index id
+ * @param kmer     Node content (2-bit packed when made only of A/C/G/T)
+ * @param children Children of the node as (index, edge weight) pairs (gets sorted)
+ * @return Success
+ */
+bool sbp::io::Database::writeAdjacency( const std::string &graph_id,
+                                        const size_t &index,
+                                        const std::string &kmer,
+                                        AdjacencyCodec::Children_t &children ) {
+    if( !switchBatchGraph( graph_id ) ) {
+        return false;
+    }
+    auto row = AdjacencyRow { index, "", false, "" };
+    row._packed = AdjacencyCodec::packKmer( kmer, row._kmer );
+    if( !row._packed ) {
+        row._kmer = kmer;
+    }
+    AdjacencyCodec::encodeChildren( index, children, row._children );
+    _adjacency_batch.emplace_back( std::move( row ) );
+    if( _adjacency_batch.size() >= ADJACENCY_BATCH_ROWS ) {
+        return flushAdjacency();
+    }
+    return true;
+}
+
+/**
+ * Writes any buffered node/edge/adjacency rows to the database
+ * @return Success
+ */
+bool sbp::io::Database::flush() {
+    bool nodes_ok     = flushNodes();
+    bool edges_ok     = flushEdges();
+    bool adjacency_ok = flushAdjacency();
+    return nodes_ok && edges_ok && adjacency_ok;
 }
 
 /**
@@ -250,13 +441,17 @@ void sbp::io::Database::beginTransaction() {
  * Commit transaction
  */
 void sbp::io::Database::commitTransaction() {
+    if( !flush() ) {
+        LOG_ERROR( "[sbp::io::Database::commitTransaction()] Problem writing buffered rows. Committing what was written." );
+    }
     _database.push( "COMMIT;" );
 }
 
 /**
- * Rollback transaction
+ * Rollback transaction (buffered rows are discarded)
  */
 void sbp::io::Database::rollbackTransaction() {
+    clearBatches();
     _database.push( "ROLLBACK;" );
 }
 
@@ -270,57 +465,33 @@ bool sbp::io::Database::loadGraph( const std::string &graph_name, eadlib::Weight
     auto graph_id = getGraphID( graph_name );
     //Error control
     if( graph_id < 0 ) {
-        LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Graph not found in DB." );
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<size_t>> )] Graph not found in DB." );
         return false;
     }
     if( !graph.isEmpty() ) {
-        LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] WeightedGraph<size_t> instance not empty." );
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<size_t>> )] WeightedGraph<size_t> instance not empty." );
         return false;
     }
+    flush(); //make any rows still buffered visible to the queries
+    if( getSchema( graph_name ) == StorageSchema::ADJACENCY_BLOB ) {
+        return loadAdjacencyGraph( graph_name, graph_id, graph );
+    }
     //Size check
-    auto table = eadlib::TableDB();
-    std::string size_query { "SELECT COUNT(*) FROM edges_" + std::to_string( graph_id ) };
-    if( _database.pull( size_query, table ) < 1 || table.at( 0, 0 ).getInt() < 1 ) {
-        LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Problem getting size of 'edges_", graph_id, "' table." );
+    std::string edges_table { "edges_" + std::to_string( graph_id ) };
+    auto total_rows = countRows( edges_table ); //a graph with no edges is valid
+    if( total_rows < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<size_t>> )] Problem getting size of '", edges_table, "' table." );
         return false;
     }
-    long long int total_rows { table.at( 0, 0 ).getInt() };
     //Filling graph
     auto progress = eadlib::cli::ProgressBar( static_cast<size_t>( total_rows ), 70 );
-    size_t chunk_size { 1000 };
-    if( total_rows < chunk_size ) { //pull everything
-        std::string all_data_query { "SELECT * FROM edges_" + std::to_string( graph_id ) };
-        if( _database.pull( all_data_query, table ) < 1 ) {
-            LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Problem pulling all data from 'edges_", graph_id, "' table." );
-            return false;
-        } else {
-            for( auto it = table.begin(); it != table.end(); ++it ) { //Iterate the rows
-                ( progress++ ).printPercentBar( std::cout, 2 );
-                graph.createDirectedEdge_fast( static_cast<size_t>( it->at( 0 ).getInt() ),   //Origin node ID
-                                               static_cast<size_t>( it->at( 1 ).getInt() ),   //Destination node ID
-                                               static_cast<size_t>( it->at( 2 ).getInt() ) ); //Edge weight
-            }
-        }
-    } else { //pull per 1000 size chunks
-        size_t chunks { 0 };
-        size_t offset { 0 };
-        std::string chunk_query = { "SELECT * FROM edges_" + std::to_string( graph_id )
-                                    + " LIMIT "  + std::to_string( chunk_size )
-                                    + " OFFSET " + std::to_string( offset ) };
-        while( _database.pull( chunk_query, table ) ) {
-            chunks++;
-            for( auto it = table.begin(); it != table.end(); ++it ) { //Iterate the rows
-                ( progress++ ).printPercentBar( std::cout, 2 );
-                graph.createDirectedEdge_fast( static_cast<size_t>( it->at( 0 ).getInt() ),   //Origin node ID
-                                               static_cast<size_t>( it->at( 1 ).getInt() ),   //Destination node ID
-                                               static_cast<size_t>( it->at( 2 ).getInt() ) ); //Edge weight
-            }
-            offset += chunk_size;
-            chunk_query = { "SELECT * FROM edges_" + std::to_string( graph_id )
-                            + " LIMIT " + std::to_string( chunk_size )
-                            + " OFFSET " + std::to_string( offset ) };
-        }
-        LOG_DEBUG( "[sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Processed ", chunks, " chunks from 'edges_", graph_id, "' table." );
+    bool success = streamEdges( edges_table, [&]( const size_t &from, const size_t &to, const size_t &weight ) {
+        ( ++progress ).printPercentBar( std::cout, 2 );
+        graph.createDirectedEdge_fast( from, to, weight );
+    } );
+    if( !success ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<size_t>> )] Problem reading '", edges_table, "' table." );
+        return false;
     }
     ( progress.complete() ).printPercentBar( std::cout, 2 );
     std::cout << std::endl;
@@ -337,115 +508,427 @@ bool sbp::io::Database::loadGraph( const std::string &graph_name, eadlib::Weight
     auto graph_id = getGraphID( graph_name );
     //Error control
     if( graph_id < 0 ) {
-        LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Graph not found in DB." );
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<std::string>> )] Graph not found in DB." );
         return false;
     }
     if( !graph.isEmpty() ) {
-        LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] WeightedGraph<size_t> instance not empty." );
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<std::string>> )] WeightedGraph<std::string> instance not empty." );
         return false;
     }
-    //Getting number of kmer nodes
-    auto table = eadlib::TableDB();
-    std::string index_size_query { "SELECT COUNT(*) FROM kmers_" + std::to_string( graph_id ) };
-    if( _database.pull( index_size_query, table ) < 1 || table.at( 0, 0 ).getInt() < 1 ) {
-        LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Problem getting size of 'kmers_", graph_id, "' table." );
+    flush(); //make any rows still buffered visible to the queries
+    if( getSchema( graph_name ) == StorageSchema::ADJACENCY_BLOB ) {
+        return loadAdjacencyGraph( graph_name, graph_id, graph );
+    }
+    if( _read_only ) {
+        return loadGraphConcurrently( graph_name, graph_id, graph );
+    }
+    //Getting number of kmer nodes and unique edges
+    std::string kmers_table { "kmers_" + std::to_string( graph_id ) };
+    std::string edges_table { "edges_" + std::to_string( graph_id ) };
+    auto total_kmer_rows = countRows( kmers_table );
+    if( total_kmer_rows < 1 ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<std::string>> )] Problem getting size of '", kmers_table, "' table." );
         return false;
     }
-    auto total_kmer_rows = static_cast<size_t>( table.at( 0, 0 ).getInt() );
-    //Getting number of unique edges
-    std::string edges_size_query { "SELECT COUNT(*) FROM edges_" + std::to_string( graph_id ) };
-    if( _database.pull( edges_size_query, table ) < 1 || table.at( 0, 0 ).getInt() < 1 ) {
-        LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Problem getting size of 'edges_", graph_id, "' table." );
+    auto total_edge_rows = countRows( edges_table ); //a graph with no edges is valid
+    if( total_edge_rows < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<std::string>> )] Problem getting size of '", edges_table, "' table." );
         return false;
     }
-    auto total_edge_rows = static_cast<size_t>( table.at( 0, 0 ).getInt() );
     //Progress bar setup
-    auto progress1 = eadlib::cli::ProgressBar( total_kmer_rows, 70 );
-    auto progress2 = eadlib::cli::ProgressBar( total_edge_rows, 70 );
+    auto progress1 = eadlib::cli::ProgressBar( static_cast<size_t>( total_kmer_rows ), 70 );
+    auto progress2 = eadlib::cli::ProgressBar( static_cast<size_t>( total_edge_rows ), 70 );
     //----Gathering index-kmer string mapping----//
     std::cout << "-> Load graph: gathering index of kmer string for mapping..." << std::endl;
-    std::unordered_map<size_t, std::string> index_map;
-    size_t chunk_size { 1000 };
-    if( total_kmer_rows < chunk_size ) { //pull everything
-        std::string all_data_query { "SELECT * FROM kmers_" + std::to_string( graph_id ) };
-        if( _database.pull( all_data_query, table ) < 1 ) {
-            LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Problem pulling all data from 'kmers_", graph_id, "' table." );
-            return false;
+    //Indices are dense [0, n) as written by the GraphIndexer so a vector is enough for the mapping
+    std::vector<std::string> index_map( static_cast<size_t>( total_kmer_rows ) );
+    bool index_error { false };
+    bool success = streamKmers( kmers_table, [&]( const size_t &index, const std::string &kmer ) {
+        ( ++progress1 ).printPercentBar( std::cout, 2 );
+        if( index < index_map.size() ) {
+            index_map[ index ] = kmer;
         } else {
-            for( auto it = table.begin(); it != table.end(); ++it ) { //Iterate the rows
-                ( progress1++ ).printPercentBar( std::cout, 2 );
-                index_map.emplace( static_cast<size_t>( it->at( 0 ).getInt() ), //Index
-                                   it->at( 1 ).getString() );                   //Kmer string
-            }
+            index_error = true;
         }
-    } else { //pull per 1000 size chunks
-        size_t chunks { 0 };
-        size_t offset { 0 };
-        std::string chunk_query = { "SELECT * FROM kmers_" + std::to_string( graph_id )
-                                    + " LIMIT "  + std::to_string( chunk_size )
-                                    + " OFFSET " + std::to_string( offset ) };
-        while( _database.pull( chunk_query, table ) ) {
-            chunks++;
-            for( auto it = table.begin(); it != table.end(); ++it ) { //Iterate the rows
-                ( progress1++ ).printPercentBar( std::cout, 2 );
-                index_map.emplace( static_cast<size_t>( it->at( 0 ).getInt() ), //Index
-                                   it->at( 1 ).getString() );                   //Kmer string
-            }
-            offset += chunk_size;
-            chunk_query = { "SELECT * FROM kmers_" + std::to_string( graph_id )
-                            + " LIMIT " + std::to_string( chunk_size )
-                            + " OFFSET " + std::to_string( offset ) };
-        }
-        LOG_DEBUG( "[sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Processed ", chunks, " chunks from 'kmers_", graph_id, "' table." );
+    } );
+    if( !success || index_error ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<std::string>> )] Problem reading '", kmers_table, "' table." );
+        return false;
     }
     ( progress1.complete() ).printPercentBar( std::cout, 2 );
     std::cout << std::endl;
     //----Processing edges from table into the graph as kmer strings----//
     std::cout << "-> Load graph: processing edges..." << std::endl;
-    //Filling graph
-    if( total_edge_rows < chunk_size ) { //pull everything
-        std::string all_data_query { "SELECT * FROM edges_" + std::to_string( graph_id ) };
-        if( _database.pull( all_data_query, table ) < 1 ) {
-            LOG_ERROR( "sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Problem pulling all data from 'edges_", graph_id, "' table." );
-            return false;
+    success = streamEdges( edges_table, [&]( const size_t &from, const size_t &to, const size_t &weight ) {
+        ( ++progress2 ).printPercentBar( std::cout, 2 );
+        if( from < index_map.size() && to < index_map.size() ) {
+            graph.createDirectedEdge_fast( index_map[ from ], //Origin node Kmer
+                                           index_map[ to ],   //Destination node Kmer
+                                           weight );          //Edge weight
         } else {
-            for( auto it = table.begin(); it != table.end(); ++it ) { //Iterate the rows
-                ( progress2++ ).printPercentBar( std::cout, 2 );
-                std::string from_kmer = index_map.at( static_cast<size_t>( it->at( 0 ).getInt() ) );
-                std::string to_kmer   = index_map.at( static_cast<size_t>( it->at( 1 ).getInt() ) );
-                size_t      weight    = static_cast<size_t>( it->at( 2 ).getInt() );
-                graph.createDirectedEdge_fast( from_kmer, //Origin node Kmer
-                                               to_kmer,   //Destination node Kmer
-                                               weight );  //Edge weight
-            }
+            index_error = true;
         }
-    } else { //pull per 1000 size chunks
-        size_t chunks { 0 };
-        size_t offset { 0 };
-        std::string chunk_query = { "SELECT * FROM edges_" + std::to_string( graph_id )
-                                    + " LIMIT "  + std::to_string( chunk_size )
-                                    + " OFFSET " + std::to_string( offset ) };
-        while( _database.pull( chunk_query, table ) ) {
-            chunks++;
-            for( auto it = table.begin(); it != table.end(); ++it ) { //Iterate the rows
-                ( progress2++ ).printPercentBar( std::cout, 2 );
-                std::string from_kmer = index_map.at( static_cast<size_t>( it->at( 0 ).getInt() ) );
-                std::string to_kmer   = index_map.at( static_cast<size_t>( it->at( 1 ).getInt() ) );
-                size_t      weight    = static_cast<size_t>( it->at( 2 ).getInt() );
-                graph.createDirectedEdge_fast( from_kmer, //Origin node Kmer
-                                               to_kmer,   //Destination node Kmer
-                                               weight );  //Edge weight
-            }
-            offset += chunk_size;
-            chunk_query = { "SELECT * FROM edges_" + std::to_string( graph_id )
-                            + " LIMIT " + std::to_string( chunk_size )
-                            + " OFFSET " + std::to_string( offset ) };
-        }
-        LOG_DEBUG( "[sbp::io::Database::loadIndexGraph( ", graph_name, ", .. )] Processed ", chunks, " chunks from 'edges_", graph_id, "' table." );
+    } );
+    if( !success || index_error ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraph( ", graph_name, ", <WeightedGraph<std::string>> )] Problem reading '", edges_table, "' table." );
+        return false;
     }
     ( progress2.complete() ).printPercentBar( std::cout, 2 );
     std::cout << std::endl;
-    return false;
+    return true;
+}
+
+/**
+ * Prepares a stored graph for incremental appending
+ * (indexes the edge endpoints and builds the K-mer -> node ID locator table on first use)
+ * @param graph_name Graph name
+ * @param kmer_size  K-mer length the graph was built with
+ * @return Success
+ */
+bool sbp::io::Database::prepareAppend( const std::string &graph_name, const size_t &kmer_size ) {
+    auto graph_id = getGraphID( graph_name );
+    //Error control
+    if( graph_id < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::prepareAppend( ", graph_name, ", ", kmer_size, " )] Graph not found in DB." );
+        return false;
+    }
+    if( _read_only ) {
+        LOG_ERROR( "[sbp::io::Database::prepareAppend( ", graph_name, ", ", kmer_size, " )] Connection is read-only." );
+        return false;
+    }
+    if( getSchema( graph_name ) != StorageSchema::EDGE_ROWS ) {
+        LOG_ERROR( "[sbp::io::Database::prepareAppend( ", graph_name, ", ", kmer_size, " )] Appending is only supported on the row-per-edge schema." );
+        return false;
+    }
+    auto stored_kmer_size = getMetadata( graph_name, "kmer_size" );
+    if( !stored_kmer_size.empty() && stored_kmer_size != std::to_string( kmer_size ) ) {
+        LOG_ERROR( "[sbp::io::Database::prepareAppend( ", graph_name, ", ", kmer_size, " )] Graph was built with K-mers of length ", stored_kmer_size, "." );
+        return false;
+    }
+    flush();
+    std::string id { std::to_string( graph_id ) };
+    if( !_database.push( "CREATE INDEX IF NOT EXISTS edges_" + id + "_from ON edges_" + id + "( From_ID )" ) ||
+        !_database.push( "CREATE INDEX IF NOT EXISTS edges_" + id + "_to ON edges_" + id + "( To_ID )" ) ) {
+        LOG_ERROR( "[sbp::io::Database::prepareAppend( ", graph_name, ", ", kmer_size, " )] Couldn't index the edges table." );
+        return false;
+    }
+    auto table = eadlib::TableDB();
+    std::string check_locator_query { "SELECT name FROM sqlite_master WHERE type='table' AND name='kmerindex_" + id + "'" };
+    if( _database.pull( check_locator_query, table ) == 0 ) {
+        std::cout << "-> DB: indexing every K-mer of the stored graph (first append only)..." << std::endl;
+        if( !_database.push( "CREATE TABLE kmerindex_" + id + "( Kmer TEXT PRIMARY KEY, ID INTEGER NOT NULL ) WITHOUT ROWID" ) ) {
+            LOG_ERROR( "[sbp::io::Database::prepareAppend( ", graph_name, ", ", kmer_size, " )] Couldn't create K-mer locator table 'kmerindex_", id, "'." );
+            return false;
+        }
+        bool error_flag { false };
+        beginTransaction();
+        bool success = streamKmers( "kmers_" + id, [&]( const size_t &index, const std::string &node ) {
+            if( !error_flag && !writeKmerLocations( id, index, node, kmer_size ) ) {
+                error_flag = true;
+            }
+        } );
+        if( !success || error_flag ) {
+            rollbackTransaction();
+            _database.push( "DROP TABLE IF EXISTS kmerindex_" + id );
+            LOG_ERROR( "[sbp::io::Database::prepareAppend( ", graph_name, ", ", kmer_size, " )] Couldn't fill K-mer locator table 'kmerindex_", id, "'." );
+            return false;
+        }
+        commitTransaction();
+    }
+    return setMetadata( graph_name, "kmer_size", std::to_string( kmer_size ) );
+}
+
+/**
+ * Counts the nodes of a stored graph
+ * @param graph_name Graph name
+ * @return Node count (-1 on error)
+ */
+signed long long sbp::io::Database::countNodes( const std::string &graph_name ) {
+    auto graph_id = getGraphID( graph_name );
+    if( graph_id < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::countNodes( ", graph_name, " )] Graph not found in DB." );
+        return -1;
+    }
+    flush();
+    return countRows( "kmers_" + std::to_string( graph_id ) );
+}
+
+/**
+ * Locates the stored nodes holding a set of K-mers (see prepareAppend(..))
+ * @param graph_name Graph name
+ * @param kmers      K-mers to look for
+ * @param locations  Container for the node ID of each K-mer found
+ * @return Success
+ */
+bool sbp::io::Database::findKmers( const std::string &graph_name,
+                                   const std::vector<std::string> &kmers,
+                                   std::unordered_map<std::string, size_t> &locations ) {
+    auto graph_id = getGraphID( graph_name );
+    if( graph_id < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::findKmers( ", graph_name, ", <std::vector<std::string>>, .. )] Graph not found in DB." );
+        return false;
+    }
+    std::string query_head { "SELECT Kmer, ID FROM kmerindex_" + std::to_string( graph_id ) + " WHERE Kmer IN " };
+    for( size_t i = 0; i < kmers.size(); i += LOOKUP_BATCH_ROWS ) {
+        auto count     = std::min( LOOKUP_BATCH_ROWS, kmers.size() - i );
+        auto statement = eadlib::wrapper::SQLiteStatement();
+        if( !_database.prepare( query_head + buildParameterList( count ), statement ) ) {
+            return false;
+        }
+        for( size_t j = 0; j < count; j++ ) {
+            statement.bindText( static_cast<int>( j + 1 ), kmers.at( i + j ) );
+        }
+        while( statement.fetch() ) {
+            locations[ statement.getString( 0 ) ] = static_cast<size_t>( statement.getInt( 1 ) );
+        }
+        if( statement.hasError() ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Reads the K-mer strings of a set of stored nodes
+ * @param graph_name Graph name
+ * @param ids        Node IDs
+ * @param nodes      Container for the K-mer string of each node ID
+ * @return Success
+ */
+bool sbp::io::Database::readNodes( const std::string &graph_name,
+                                   const std::vector<size_t> &ids,
+                                   std::unordered_map<size_t, std::string> &nodes ) {
+    auto graph_id = getGraphID( graph_name );
+    if( graph_id < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::readNodes( ", graph_name, ", <std::vector<size_t>>, .. )] Graph not found in DB." );
+        return false;
+    }
+    std::string query_head { "SELECT ID, Kmer FROM kmers_" + std::to_string( graph_id ) + " WHERE ID IN " };
+    for( size_t i = 0; i < ids.size(); i += LOOKUP_BATCH_ROWS ) {
+        auto count     = std::min( LOOKUP_BATCH_ROWS, ids.size() - i );
+        auto statement = eadlib::wrapper::SQLiteStatement();
+        if( !_database.prepare( query_head + buildParameterList( count ), statement ) ) {
+            return false;
+        }
+        for( size_t j = 0; j < count; j++ ) {
+            statement.bindInt( static_cast<int>( j + 1 ), static_cast<sqlite3_int64>( ids.at( i + j ) ) );
+        }
+        while( statement.fetch() ) {
+            nodes[ static_cast<size_t>( statement.getInt( 0 ) ) ] = statement.getString( 1 );
+        }
+        if( statement.hasError() ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Reads the stored edges going from or to a set of nodes
+ * (an edge between two nodes of the set can be given more than once)
+ * @param graph_name Graph name
+ * @param ids        Node IDs
+ * @param callback   Function called for each edge row
+ * @return Success
+ */
+bool sbp::io::Database::readEdges( const std::string &graph_name,
+                                   const std::vector<size_t> &ids,
+                                   const std::function<void( const size_t &from, const size_t &to, const size_t &weight )> &callback ) {
+    auto graph_id = getGraphID( graph_name );
+    if( graph_id < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::readEdges( ", graph_name, ", <std::vector<size_t>>, .. )] Graph not found in DB." );
+        return false;
+    }
+    std::string edges_table { "edges_" + std::to_string( graph_id ) };
+    for( size_t i = 0; i < ids.size(); i += LOOKUP_BATCH_ROWS / 2 ) {
+        auto count     = std::min( LOOKUP_BATCH_ROWS / 2, ids.size() - i );
+        auto list      = buildParameterList( count );
+        auto statement = eadlib::wrapper::SQLiteStatement();
+        if( !_database.prepare( "SELECT From_ID, To_ID, Weight FROM " + edges_table + " WHERE From_ID IN " + list + " OR To_ID IN " + list, statement ) ) {
+            return false;
+        }
+        for( size_t j = 0; j < count; j++ ) {
+            statement.bindInt( static_cast<int>( j + 1 ), static_cast<sqlite3_int64>( ids.at( i + j ) ) );
+            statement.bindInt( static_cast<int>( j + 1 + count ), static_cast<sqlite3_int64>( ids.at( i + j ) ) );
+        }
+        while( statement.fetch() ) {
+            callback( static_cast<size_t>( statement.getInt( 0 ) ),   //From
+                      static_cast<size_t>( statement.getInt( 1 ) ),   //To
+                      static_cast<size_t>( statement.getInt( 2 ) ) ); //Weight
+        }
+        if( statement.hasError() ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Removes a set of stored nodes along with their edges and K-mer locations
+ * @param graph_name Graph name
+ * @param nodes      Node IDs and their K-mer strings
+ * @param kmer_size  K-mer length the graph was built with
+ * @return Success
+ */
+bool sbp::io::Database::removeNodes( const std::string &graph_name,
+                                     const std::unordered_map<size_t, std::string> &nodes,
+                                     const size_t &kmer_size ) {
+    auto graph_id = getGraphID( graph_name );
+    if( graph_id < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::removeNodes( ", graph_name, ", <std::unordered_map<size_t, std::string>>, ", kmer_size, " )] Graph not found in DB." );
+        return false;
+    }
+    flush();
+    std::string id { std::to_string( graph_id ) };
+    std::vector<size_t> ids;
+    std::vector<std::string> kmers;
+    for( auto node : nodes ) {
+        ids.emplace_back( node.first );
+        for( size_t i = 0; i + kmer_size <= node.second.size(); i++ ) {
+            kmers.emplace_back( node.second.substr( i, kmer_size ) );
+        }
+    }
+    for( size_t i = 0; i < ids.size(); i += LOOKUP_BATCH_ROWS / 2 ) {
+        auto count           = std::min( LOOKUP_BATCH_ROWS / 2, ids.size() - i );
+        auto list            = buildParameterList( count );
+        auto node_statement  = eadlib::wrapper::SQLiteStatement();
+        auto edges_statement = eadlib::wrapper::SQLiteStatement();
+        if( !_database.prepare( "DELETE FROM kmers_" + id + " WHERE ID IN " + list, node_statement ) ||
+            !_database.prepare( "DELETE FROM edges_" + id + " WHERE From_ID IN " + list + " OR To_ID IN " + list, edges_statement ) ) {
+            return false;
+        }
+        for( size_t j = 0; j < count; j++ ) {
+            auto value = static_cast<sqlite3_int64>( ids.at( i + j ) );
+            node_statement.bindInt( static_cast<int>( j + 1 ), value );
+            edges_statement.bindInt( static_cast<int>( j + 1 ), value );
+            edges_statement.bindInt( static_cast<int>( j + 1 + count ), value );
+        }
+        if( !node_statement.execute() || !edges_statement.execute() ) {
+            LOG_ERROR( "[sbp::io::Database::removeNodes( ", graph_name, ", <std::unordered_map<size_t, std::string>>, ", kmer_size, " )] Couldn't delete node/edge rows." );
+            return false;
+        }
+    }
+    for( size_t i = 0; i < kmers.size(); i += LOOKUP_BATCH_ROWS ) {
+        auto count     = std::min( LOOKUP_BATCH_ROWS, kmers.size() - i );
+        auto statement = eadlib::wrapper::SQLiteStatement();
+        if( !_database.prepare( "DELETE FROM kmerindex_" + id + " WHERE Kmer IN " + buildParameterList( count ), statement ) ) {
+            return false;
+        }
+        for( size_t j = 0; j < count; j++ ) {
+            statement.bindText( static_cast<int>( j + 1 ), kmers.at( i + j ) );
+        }
+        if( !statement.execute() ) {
+            LOG_ERROR( "[sbp::io::Database::removeNodes( ", graph_name, ", <std::unordered_map<size_t, std::string>>, ", kmer_size, " )] Couldn't delete K-mer locations." );
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Moves a stored node to another (free) ID
+ * @param graph_name Graph name
+ * @param from       Current node ID
+ * @param to         New node ID
+ * @param kmer_size  K-mer length the graph was built with
+ * @return Success
+ */
+bool sbp::io::Database::moveNode( const std::string &graph_name, const size_t &from, const size_t &to, const size_t &kmer_size ) {
+    auto graph_id = getGraphID( graph_name );
+    if( graph_id < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::moveNode( ", graph_name, ", ", from, ", ", to, ", ", kmer_size, " )] Graph not found in DB." );
+        return false;
+    }
+    flush();
+    std::string id { std::to_string( graph_id ) };
+    std::unordered_map<size_t, std::string> node;
+    if( !readNodes( graph_name, std::vector<size_t>( { from } ), node ) || node.empty() ) {
+        LOG_ERROR( "[sbp::io::Database::moveNode( ", graph_name, ", ", from, ", ", to, ", ", kmer_size, " )] Node not found in DB." );
+        return false;
+    }
+    std::vector<std::string> updates { "UPDATE kmers_" + id + " SET ID=?1 WHERE ID=?2",
+                                       "UPDATE edges_" + id + " SET From_ID=?1 WHERE From_ID=?2",
+                                       "UPDATE edges_" + id + " SET To_ID=?1 WHERE To_ID=?2" };
+    for( auto query : updates ) {
+        auto statement = eadlib::wrapper::SQLiteStatement();
+        if( !_database.prepare( query, statement ) ) {
+            return false;
+        }
+        statement.bindInt( 1, static_cast<sqlite3_int64>( to ) );
+        statement.bindInt( 2, static_cast<sqlite3_int64>( from ) );
+        if( !statement.execute() ) {
+            LOG_ERROR( "[sbp::io::Database::moveNode( ", graph_name, ", ", from, ", ", to, ", ", kmer_size, " )] Couldn't update rows: ", query );
+            return false;
+        }
+    }
+    return writeKmerLocations( id, to, node.at( from ), kmer_size );
+}
+
+/**
+ * Writes the location of every K-mer held by a node into the K-mer locator table
+ * @param graph_id  Graph ID
+ * @param index     Node ID
+ * @param node      Node's K-mer string
+ * @param kmer_size K-mer length the graph was built with
+ * @return Success
+ */
+bool sbp::io::Database::writeKmerLocations( const std::string &graph_id,
+                                            const size_t &index,
+                                            const std::string &node,
+                                            const size_t &kmer_size ) {
+    auto statement = eadlib::wrapper::SQLiteStatement();
+    if( !_database.prepare( "INSERT OR REPLACE INTO kmerindex_" + graph_id + " (Kmer, ID) VALUES (?,?)", statement ) ) {
+        return false;
+    }
+    for( size_t i = 0; i + kmer_size <= node.size(); i++ ) {
+        statement.bindText( 1, node.substr( i, kmer_size ) );
+        statement.bindInt( 2, static_cast<sqlite3_int64>( index ) );
+        if( !statement.execute() ) {
+            LOG_ERROR( "[sbp::io::Database::writeKmerLocations( ", graph_id, ", ", index, ", ", node, ", ", kmer_size, " )] Couldn't write K-mer location." );
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Checks the base tables of the database and creates them if missing
+ * @param file_name Database file name
+ * @return Success
+ */
+bool sbp::io::Database::checkTables( const std::string &file_name ) {
+    auto table = eadlib::TableDB();
+    std::string check_graph_table_query = { "SELECT name FROM sqlite_master WHERE type='table' AND name='Graphs' COLLATE NOCASE" };
+    if( _database.pull( check_graph_table_query, table ) == 0 ) {
+        std::string create_table_query { "CREATE TABLE Graphs("
+                                             "GraphID INTEGER PRIMARY KEY, "
+                                             "Name TEXT NOT NULL, "
+                                             "CONSTRAINT unique_name UNIQUE( Name ));"
+        };
+        if( !_database.push( create_table_query ) ) {
+            LOG_ERROR( "[sbp::io::Database::checkTables( ", file_name, " )] Problem creating 'Graphs' table in database." );
+            return false;
+        } else {
+            LOG_DEBUG( "[sbp::io::Database::checkTables( ", file_name, " )] New DB detected. Created a 'Graphs' table." );
+        }
+    }
+    std::string check_meta_table_query = { "SELECT name FROM sqlite_master WHERE type='table' AND name='GraphMeta' COLLATE NOCASE" };
+    if( _database.pull( check_meta_table_query, table ) == 0 ) {
+        std::string create_table_query { "CREATE TABLE GraphMeta("
+                                             "GraphID INTEGER NOT NULL, "
+                                             "Key TEXT NOT NULL, "
+                                             "Value TEXT NOT NULL, "
+                                             "CONSTRAINT unique_key UNIQUE( GraphID, Key ), "
+                                             "FOREIGN KEY(GraphID) REFERENCES Graphs(GraphID));"
+        };
+        if( !_database.push( create_table_query ) ) {
+            LOG_ERROR( "[sbp::io::Database::checkTables( ", file_name, " )] Problem creating 'GraphMeta' table in database." );
+            return false;
+        } else {
+            LOG_DEBUG( "[sbp::io::Database::checkTables( ", file_name, " )] Created a 'GraphMeta' table." );
+        }
+    }
+    return true;
 }
 
 /**
@@ -463,3 +946,454 @@ signed long long sbp::io::Database::getGraphID( const std::string &graph_name )
         return table.at( 0, 0 ).getInt();
     }
 }
+
+/**
+ * Counts the rows in a table
+ * @param table Table name
+ * @return Number of rows (-1 on error)
+ */
+signed long long sbp::io::Database::countRows( const std::string &table ) {
+    auto statement = eadlib::wrapper::SQLiteStatement();
+    if( !_database.prepare( "SELECT COUNT(*) FROM " + table, statement ) || !statement.fetch() ) {
+        return -1;
+    }
+    return statement.getInt( 0 );
+}
+
+/**
+ * Streams all the rows of an edge table to a callback in a single pass
+ * @param table    Edge table name
+ * @param callback Function to call with each row's origin, destination and weight
+ * @return Success
+ */
+bool sbp::io::Database::streamEdges( const std::string &table,
+                                     const std::function<void( const size_t &, const size_t &, const size_t & )> &callback ) {
+    auto statement = eadlib::wrapper::SQLiteStatement();
+    if( !_database.prepare( "SELECT From_ID, To_ID, Weight FROM " + table, statement ) ) {
+        return false;
+    }
+    while( statement.fetch() ) {
+        callback( static_cast<size_t>( statement.getInt( 0 ) ),   //Origin node ID
+                  static_cast<size_t>( statement.getInt( 1 ) ),   //Destination node ID
+                  static_cast<size_t>( statement.getInt( 2 ) ) ); //Edge weight
+    }
+    return !statement.hasError();
+}
+
+/**
+ * Streams all the rows of a kmer (or adjacency) table to a callback in a single pass
+ * (2-bit packed BLOB kmers are unpacked)
+ * @param table    Kmer table name
+ * @param callback Function to call with each row's index and kmer string
+ * @return Success
+ */
+bool sbp::io::Database::streamKmers( const std::string &table,
+                                     const std::function<void( const size_t &, const std::string & )> &callback ) {
+    auto statement = eadlib::wrapper::SQLiteStatement();
+    if( !_database.prepare( "SELECT ID, Kmer FROM " + table, statement ) ) {
+        return false;
+    }
+    std::string kmer;
+    while( statement.fetch() ) {
+        if( statement.getColumnType( 1 ) == SQLITE_BLOB ) {
+            size_t size { 0 };
+            auto   data = statement.getBlob( 1, size );
+            if( !AdjacencyCodec::unpackKmer( data, size, kmer ) ) {
+                LOG_ERROR( "[sbp::io::Database::streamKmers( ", table, ", .. )] Corrupted kmer BLOB on row ID=", statement.getInt( 0 ), "." );
+                return false;
+            }
+        } else {
+            kmer = statement.getString( 1 );
+        }
+        callback( static_cast<size_t>( statement.getInt( 0 ) ), //Index
+                  kmer );                                       //Kmer string
+    }
+    return !statement.hasError();
+}
+
+/**
+ * Streams the children BLOB of every row of an adjacency table to a callback in a single pass
+ * @param table    Adjacency table name
+ * @param callback Function to call with each row's index and children BLOB (returns false to signal a problem)
+ * @return Success
+ */
+bool sbp::io::Database::streamAdjacency( const std::string &table,
+                                         const std::function<bool( const size_t &, const unsigned char *, const size_t & )> &callback ) {
+    auto statement = eadlib::wrapper::SQLiteStatement();
+    if( !_database.prepare( "SELECT ID, Children FROM " + table, statement ) ) {
+        return false;
+    }
+    while( statement.fetch() ) {
+        size_t size { 0 };
+        auto   data = statement.getBlob( 1, size );
+        if( !callback( static_cast<size_t>( statement.getInt( 0 ) ), data, size ) ) {
+            LOG_ERROR( "[sbp::io::Database::streamAdjacency( ", table, ", .. )] Problem processing row ID=", statement.getInt( 0 ), "." );
+            return false;
+        }
+    }
+    return !statement.hasError();
+}
+
+/**
+ * Loads an index graph stored with the adjacency BLOB schema
+ * @param graph_name Graph name
+ * @param graph_id   Graph ID
+ * @param graph      Index graph instance to load into
+ * @return Success
+ */
+bool sbp::io::Database::loadAdjacencyGraph( const std::string &graph_name,
+                                            const signed long long &graph_id,
+                                            eadlib::WeightedGraph<size_t> &graph ) {
+    std::string adjacency_table { "adjacency_" + std::to_string( graph_id ) };
+    auto total_rows = countRows( adjacency_table );
+    if( total_rows < 1 ) {
+        LOG_ERROR( "[sbp::io::Database::loadAdjacencyGraph( ", graph_name, ", ", graph_id, ", <WeightedGraph<size_t>> )] Problem getting size of '", adjacency_table, "' table." );
+        return false;
+    }
+    auto progress = eadlib::cli::ProgressBar( static_cast<size_t>( total_rows ), 70 );
+    auto children = AdjacencyCodec::Children_t();
+    bool success  = streamAdjacency( adjacency_table, [&]( const size_t &index, const unsigned char *data, const size_t &size ) {
+        ( ++progress ).printPercentBar( std::cout, 2 );
+        if( !AdjacencyCodec::decodeChildren( index, data, size, children ) ) {
+            return false;
+        }
+        graph.addNode( index );
+        for( const auto &child : children ) {
+            graph.createDirectedEdge_fast( index, child.first, child.second );
+        }
+        return true;
+    } );
+    if( !success ) {
+        LOG_ERROR( "[sbp::io::Database::loadAdjacencyGraph( ", graph_name, ", ", graph_id, ", <WeightedGraph<size_t>> )] Problem reading '", adjacency_table, "' table." );
+        return false;
+    }
+    ( progress.complete() ).printPercentBar( std::cout, 2 );
+    std::cout << std::endl;
+    return true;
+}
+
+/**
+ * Loads a Kmer string graph stored with the adjacency BLOB schema
+ * @param graph_name Graph name
+ * @param graph_id   Graph ID
+ * @param graph      Kmer string graph instance to load into
+ * @return Success
+ */
+bool sbp::io::Database::loadAdjacencyGraph( const std::string &graph_name,
+                                            const signed long long &graph_id,
+                                            eadlib::WeightedGraph<std::string> &graph ) {
+    std::string adjacency_table { "adjacency_" + std::to_string( graph_id ) };
+    auto total_rows = countRows( adjacency_table );
+    if( total_rows < 1 ) {
+        LOG_ERROR( "[sbp::io::Database::loadAdjacencyGraph( ", graph_name, ", ", graph_id, ", <WeightedGraph<std::string>> )] Problem getting size of '", adjacency_table, "' table." );
+        return false;
+    }
+    auto progress1 = eadlib::cli::ProgressBar( static_cast<size_t>( total_rows ), 70 );
+    auto progress2 = eadlib::cli::ProgressBar( static_cast<size_t>( total_rows ), 70 );
+    //----Gathering index-kmer string mapping----//
+    std::cout << "-> Load graph: gathering index of kmer string for mapping..." << std::endl;
+    std::vector<std::string> index_map( static_cast<size_t>( total_rows ) );
+    bool index_error { false };
+    bool success = streamKmers( adjacency_table, [&]( const size_t &index, const std::string &kmer ) {
+        ( ++progress1 ).printPercentBar( std::cout, 2 );
+        if( index < index_map.size() ) {
+            index_map[ index ] = kmer;
+            graph.addNode( kmer );
+        } else {
+            index_error = true;
+        }
+    } );
+    if( !success || index_error ) {
+        LOG_ERROR( "[sbp::io::Database::loadAdjacencyGraph( ", graph_name, ", ", graph_id, ", <WeightedGraph<std::string>> )] Problem reading kmers from '", adjacency_table, "' table." );
+        return false;
+    }
+    ( progress1.complete() ).printPercentBar( std::cout, 2 );
+    std::cout << std::endl;
+    //----Processing children into the graph as kmer strings----//
+    std::cout << "-> Load graph: processing edges..." << std::endl;
+    auto children = AdjacencyCodec::Children_t();
+    success = streamAdjacency( adjacency_table, [&]( const size_t &index, const unsigned char *data, const size_t &size ) {
+        ( ++progress2 ).printPercentBar( std::cout, 2 );
+        if( index >= index_map.size() || !AdjacencyCodec::decodeChildren( index, data, size, children ) ) {
+            return false;
+        }
+        for( const auto &child : children ) {
+            if( child.first >= index_map.size() ) {
+                return false;
+            }
+            graph.createDirectedEdge_fast( index_map[ index ], index_map[ child.first ], child.second );
+        }
+        return true;
+    } );
+    if( !success ) {
+        LOG_ERROR( "[sbp::io::Database::loadAdjacencyGraph( ", graph_name, ", ", graph_id, ", <WeightedGraph<std::string>> )] Problem reading children from '", adjacency_table, "' table." );
+        return false;
+    }
+    ( progress2.complete() ).printPercentBar( std::cout, 2 );
+    std::cout << std::endl;
+    return true;
+}
+
+/**
+ * Loads a Kmer string graph with the row-per-edge schema over two read-only connections
+ * (a worker thread reads the kmers on its own connection while the edges are read here;
+ *  edges whose kmers are already in are inserted straight away, the rest once all kmers are read)
+ * @param graph_name Graph name
+ * @param graph_id   Graph ID
+ * @param graph      Kmer string graph instance to load into
+ * @return Success
+ */
+bool sbp::io::Database::loadGraphConcurrently( const std::string &graph_name,
+                                               const signed long long &graph_id,
+                                               eadlib::WeightedGraph<std::string> &graph ) {
+    std::string kmers_table { "kmers_" + std::to_string( graph_id ) };
+    std::string edges_table { "edges_" + std::to_string( graph_id ) };
+    auto total_kmer_rows = countRows( kmers_table );
+    auto total_edge_rows = countRows( edges_table ); //a graph with no edges is valid
+    if( total_kmer_rows < 1 || total_edge_rows < 0 ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraphConcurrently( ", graph_name, ", ", graph_id, ", .. )] Problem getting size of the graph tables." );
+        return false;
+    }
+    auto kmer_db = Database();
+    if( !kmer_db.openReadOnly( _database.getFileName() ) ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraphConcurrently( ", graph_name, ", ", graph_id, ", .. )] Could not open a second connection to the database." );
+        return false;
+    }
+    //----Kmers (worker thread)----//
+    //'ready' is the count of contiguous indices [0, ready) already in 'index_map' (rows are normally in ID order)
+    std::vector<std::string> index_map( static_cast<size_t>( total_kmer_rows ) );
+    std::atomic<size_t>      ready( 0 );
+    bool                     kmer_success { false };
+    std::cout << "-> Load graph: reading kmers and edges concurrently..." << std::endl;
+    auto kmer_reader = std::thread( [&]() {
+        std::vector<bool> filled( index_map.size(), false );
+        size_t contiguous { 0 };
+        bool   index_error { false };
+        bool   success = kmer_db.streamKmers( kmers_table, [&]( const size_t &index, const std::string &kmer ) {
+            if( index >= index_map.size() || filled[ index ] ) {
+                index_error = true;
+                return;
+            }
+            index_map[ index ] = kmer;
+            filled[ index ]    = true;
+            while( contiguous < filled.size() && filled[ contiguous ] ) {
+                contiguous++;
+            }
+            ready.store( contiguous, std::memory_order_release );
+        } );
+        kmer_success = success && !index_error && contiguous == index_map.size();
+    } );
+    //----Edges (this thread)----//
+    std::vector<EdgeRow> pending;
+    auto progress = eadlib::cli::ProgressBar( static_cast<size_t>( total_edge_rows ), 70 );
+    bool edge_success = streamEdges( edges_table, [&]( const size_t &from, const size_t &to, const size_t &weight ) {
+        ( ++progress ).printPercentBar( std::cout, 2 );
+        size_t available = ready.load( std::memory_order_acquire );
+        if( from < available && to < available ) {
+            graph.createDirectedEdge_fast( index_map[ from ], index_map[ to ], weight );
+        } else {
+            pending.emplace_back( EdgeRow { from, to, weight } );
+        }
+    } );
+    kmer_reader.join();
+    kmer_db.close();
+    if( !kmer_success ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraphConcurrently( ", graph_name, ", ", graph_id, ", .. )] Problem reading '", kmers_table, "' table." );
+        return false;
+    }
+    //----Edges that arrived before their kmers----//
+    for( const auto &edge : pending ) {
+        if( edge._from >= index_map.size() || edge._to >= index_map.size() ) {
+            edge_success = false;
+            break;
+        }
+        graph.createDirectedEdge_fast( index_map[ edge._from ], index_map[ edge._to ], edge._weight );
+    }
+    if( !edge_success ) {
+        LOG_ERROR( "[sbp::io::Database::loadGraphConcurrently( ", graph_name, ", ", graph_id, ", .. )] Problem reading '", edges_table, "' table." );
+        return false;
+    }
+    ( progress.complete() ).printPercentBar( std::cout, 2 );
+    std::cout << std::endl;
+    LOG_DEBUG( "[sbp::io::Database::loadGraphConcurrently( ", graph_name, ", ", graph_id, ", .. )] ", pending.size(), " edge(s) had to wait on their kmers." );
+    return true;
+}
+
+/**
+ * Sets the graph the buffered rows are written to
+ * (pending rows of the previous graph are flushed and its cached statements dropped)
+ * @param graph_id Graph ID
+ * @return Success
+ */
+bool sbp::io::Database::switchBatchGraph( const std::string &graph_id ) {
+    if( graph_id == _batch_graph_id ) {
+        return true;
+    }
+    bool success = flush();
+    finalizeInserts();
+    _batch_graph_id = graph_id;
+    return success;
+}
+
+/**
+ * Inserts the buffered node rows into the kmer table
+ * @return Success
+ */
+bool sbp::io::Database::flushNodes() {
+    if( _node_batch.empty() ) {
+        return true;
+    }
+    //Full batches reuse the cached statement, a trailing partial batch gets a one-off statement
+    eadlib::wrapper::SQLiteStatement tail_insert;
+    auto &statement = ( _node_batch.size() == NODE_BATCH_ROWS ) ? _node_insert : tail_insert;
+    if( !statement.isPrepared() ) {
+        auto query = buildInsertQuery( "kmers_" + _batch_graph_id, "ID, Kmer", 2, _node_batch.size() );
+        if( !_database.prepare( query, statement ) ) {
+            LOG_ERROR( "[sbp::io::Database::flushNodes()] Could not prepare insert for 'kmers_", _batch_graph_id, "'. ", _node_batch.size(), " rows dropped." );
+            _node_batch.clear();
+            return false;
+        }
+    }
+    int parameter { 1 };
+    for( const auto &row : _node_batch ) {
+        statement.bindInt( parameter++, static_cast<sqlite3_int64>( row._index ) );
+        statement.bindText( parameter++, row._kmer );
+    }
+    bool success = statement.execute();
+    if( !success ) {
+        LOG_ERROR( "[sbp::io::Database::flushNodes()] Problem inserting ", _node_batch.size(), " rows into 'kmers_", _batch_graph_id, "'." );
+    }
+    _node_batch.clear();
+    return success;
+}
+
+/**
+ * Inserts the buffered edge rows into the edge table
+ * @return Success
+ */
+bool sbp::io::Database::flushEdges() {
+    if( _edge_batch.empty() ) {
+        return true;
+    }
+    //Full batches reuse the cached statement, a trailing partial batch gets a one-off statement
+    eadlib::wrapper::SQLiteStatement tail_insert;
+    auto &statement = ( _edge_batch.size() == EDGE_BATCH_ROWS ) ? _edge_insert : tail_insert;
+    if( !statement.isPrepared() ) {
+        auto query = buildInsertQuery( "edges_" + _batch_graph_id, "From_ID, To_ID, Weight", 3, _edge_batch.size() );
+        if( !_database.prepare( query, statement ) ) {
+            LOG_ERROR( "[sbp::io::Database::flushEdges()] Could not prepare insert for 'edges_", _batch_graph_id, "'. ", _edge_batch.size(), " rows dropped." );
+            _edge_batch.clear();
+            return false;
+        }
+    }
+    int parameter { 1 };
+    for( const auto &row : _edge_batch ) {
+        statement.bindInt( parameter++, static_cast<sqlite3_int64>( row._from ) );
+        statement.bindInt( parameter++, static_cast<sqlite3_int64>( row._to ) );
+        statement.bindInt( parameter++, static_cast<sqlite3_int64>( row._weight ) );
+    }
+    bool success = statement.execute();
+    if( !success ) {
+        LOG_ERROR( "[sbp::io::Database::flushEdges()] Problem inserting ", _edge_batch.size(), " rows into 'edges_", _batch_graph_id, "'." );
+    }
+    _edge_batch.clear();
+    return success;
+}
+
+/**
+ * Inserts the buffered adjacency rows into the adjacency table
+ * @return Success
+ */
+bool sbp::io::Database::flushAdjacency() {
+    if( _adjacency_batch.empty() ) {
+        return true;
+    }
+    //Full batches reuse the cached statement, a trailing partial batch gets a one-off statement
+    eadlib::wrapper::SQLiteStatement tail_insert;
+    auto &statement = ( _adjacency_batch.size() == ADJACENCY_BATCH_ROWS ) ? _adjacency_insert : tail_insert;
+    if( !statement.isPrepared() ) {
+        auto query = buildInsertQuery( "adjacency_" + _batch_graph_id, "ID, Kmer, Children", 3, _adjacency_batch.size() );
+        if( !_database.prepare( query, statement ) ) {
+            LOG_ERROR( "[sbp::io::Database::flushAdjacency()] Could not prepare insert for 'adjacency_", _batch_graph_id, "'. ", _adjacency_batch.size(), " rows dropped." );
+            _adjacency_batch.clear();
+            return false;
+        }
+    }
+    int parameter { 1 };
+    for( const auto &row : _adjacency_batch ) {
+        statement.bindInt( parameter++, static_cast<sqlite3_int64>( row._index ) );
+        if( row._packed ) {
+            statement.bindBlob( parameter++, row._kmer.data(), row._kmer.size() );
+        } else {
+            statement.bindText( parameter++, row._kmer );
+        }
+        statement.bindBlob( parameter++, row._children.data(), row._children.size() );
+    }
+    bool success = statement.execute();
+    if( !success ) {
+        LOG_ERROR( "[sbp::io::Database::flushAdjacency()] Problem inserting ", _adjacency_batch.size(), " rows into 'adjacency_", _batch_graph_id, "'." );
+    }
+    _adjacency_batch.clear();
+    return success;
+}
+
+/**
+ * Discards any buffered node/edge/adjacency rows
+ */
+void sbp::io::Database::clearBatches() {
+    _node_batch.clear();
+    _edge_batch.clear();
+    _adjacency_batch.clear();
+}
+
+/**
+ * Finalizes the cached batch insert statements
+ */
+void sbp::io::Database::finalizeInserts() {
+    _node_insert.finalize();
+    _edge_insert.finalize();
+    _adjacency_insert.finalize();
+}
+
+/**
+ * Builds a bound parameter list for an IN clause
+ * @param count Number of parameters
+ * @return Parameter list string (e.g.: '(?,?,?)')
+ */
+std::string sbp::io::Database::buildParameterList( const size_t &count ) const {
+    std::string list { "(" };
+    list.reserve( count * 2 + 1 );
+    for( size_t i = 0; i < count; i++ ) {
+        list += ( i == 0 ? "?" : ",?" );
+    }
+    return list + ")";
+}
+
+/**
+ * Builds a multi-row parametrised INSERT query
+ * e.g.: "INSERT INTO t (a, b) VALUES (?,?),(?,?)"
+ * @param table        Table name
+ * @param columns      Comma separated column names
+ * @param column_count Number of columns
+ * @param row_count    Number of rows
+ * @return Query string
+ */
+std::string sbp::io::Database::buildInsertQuery( const std::string &table,
+                                                 const std::string &columns,
+                                                 const size_t &column_count,
+                                                 const size_t &row_count ) const {
+    std::string row { "(" };
+    for( size_t i = 0; i < column_count; i++ ) {
+        row += ( i == 0 ? "?" : ",?" );
+    }
+    row += ")";
+    std::string query { "INSERT INTO " + table + " (" + columns + ") VALUES " };
+    query.reserve( query.size() + row_count * ( row.size() + 1 ) );
+    for( size_t i = 0; i < row_count; i++ ) {
+        if( i > 0 ) {
+            query += ",";
+        }
+        query += row;
+    }
+    return query;
+}
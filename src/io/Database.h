@@ -1,12 +1,27 @@
 #ifndef SUPERBUBBLE_PERFORMANCE_DATABASE_H
 #define SUPERBUBBLE_PERFORMANCE_DATABASE_H
 
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <thread>
 #include <eadlib/datastructure/WeightedGraph.h>
 #include "eadlib/logger/Logger.h"
 #include "eadlib/wrapper/SQLite/SQLite.h"
+#include "AdjacencyCodec.h"
 
 namespace sbp {
     namespace io {
+        /**
+         * @brief   Storage layouts available for a graph in the sbp::io::Database
+         */
+        enum class StorageSchema {
+            EDGE_ROWS,     //'kmers_n' (ID, Kmer) + 'edges_n' (From_ID, To_ID, Weight)
+            ADJACENCY_BLOB //'adjacency_n' (ID, Kmer, Children) with encoded BLOBs
+        };
+
         class Database {
           public:
             Database();
@@ -16,26 +31,109 @@ namespace sbp {
             Database & operator =( const Database &rhs ) = delete;
             Database & operator =( Database &&rhs ) noexcept;
             bool open( const std::string &file_name );
+            bool openReadOnly( const std::string &file_name );
             bool close();
             bool isOpen() const;
-            bool create( const std::string &graph_name );
+            bool isReadOnly() const;
+            bool create( const std::string &graph_name, const StorageSchema &schema = StorageSchema::EDGE_ROWS );
             bool remove( const std::string &graph_name );
             bool exists( const std::string &graph_name );
             std::ostream & listGraphs( std::ostream &out );
             std::string getID( const std::string &graph_name );
+            bool setMetadata( const std::string &graph_name, const std::string &key, const std::string &value );
+            std::string getMetadata( const std::string &graph_name, const std::string &key );
+            std::string findGraph( const std::string &key, const std::string &value );
+            StorageSchema getSchema( const std::string &graph_name );
             bool writeNode( const std::string &graph_id,
                             const size_t &index,
                             const std::string &kmer );
             bool writeEdge( const std::string &graph_id, const size_t &from, const size_t &to, const size_t &weight );
+            bool writeAdjacency( const std::string &graph_id,
+                                 const size_t &index,
+                                 const std::string &kmer,
+                                 AdjacencyCodec::Children_t &children );
+            bool flush();
             void beginTransaction();
             void commitTransaction();
             void rollbackTransaction();
             bool loadGraph( const std::string &graph_name, eadlib::WeightedGraph<size_t> &graph );
             bool loadGraph( const std::string &graph_name, eadlib::WeightedGraph<std::string> &graph );
+            //Incremental appending (row-per-edge schema only)
+            bool prepareAppend( const std::string &graph_name, const size_t &kmer_size );
+            signed long long countNodes( const std::string &graph_name );
+            bool findKmers( const std::string &graph_name,
+                            const std::vector<std::string> &kmers,
+                            std::unordered_map<std::string, size_t> &locations );
+            bool readNodes( const std::string &graph_name,
+                            const std::vector<size_t> &ids,
+                            std::unordered_map<size_t, std::string> &nodes );
+            bool readEdges( const std::string &graph_name,
+                            const std::vector<size_t> &ids,
+                            const std::function<void( const size_t &from, const size_t &to, const size_t &weight )> &callback );
+            bool removeNodes( const std::string &graph_name,
+                              const std::unordered_map<size_t, std::string> &nodes,
+                              const size_t &kmer_size );
+            bool moveNode( const std::string &graph_name, const size_t &from, const size_t &to, const size_t &kmer_size );
+            bool writeKmerLocations( const std::string &graph_id,
+                                     const size_t &index,
+                                     const std::string &node,
+                                     const size_t &kmer_size );
           private:
+            struct NodeRow {
+                size_t      _index;
+                std::string _kmer;
+            };
+            struct EdgeRow {
+                size_t _from;
+                size_t _to;
+                size_t _weight;
+            };
+            struct AdjacencyRow {
+                size_t      _index;
+                std::string _kmer;     //2-bit packed when '_packed' is set, plain text otherwise
+                bool        _packed;
+                std::string _children; //encoded children BLOB
+            };
+            //Rows per multi-row INSERT (SQLite caps bound parameters at 999 per statement)
+            static constexpr size_t NODE_BATCH_ROWS = 999 / 2;
+            static constexpr size_t EDGE_BATCH_ROWS = 999 / 3;
+            static constexpr size_t ADJACENCY_BATCH_ROWS = 999 / 3;
+            //Bound parameters per IN clause lookup
+            static constexpr size_t LOOKUP_BATCH_ROWS = 999;
+            bool checkTables( const std::string &file_name );
             signed long long getGraphID( const std::string &graph_name );
+            signed long long countRows( const std::string &table );
+            bool streamEdges( const std::string &table,
+                              const std::function<void( const size_t &from, const size_t &to, const size_t &weight )> &callback );
+            bool streamKmers( const std::string &table,
+                              const std::function<void( const size_t &index, const std::string &kmer )> &callback );
+            bool streamAdjacency( const std::string &table,
+                                  const std::function<bool( const size_t &index, const unsigned char *children, const size_t &size )> &callback );
+            bool loadAdjacencyGraph( const std::string &graph_name, const signed long long &graph_id, eadlib::WeightedGraph<size_t> &graph );
+            bool loadAdjacencyGraph( const std::string &graph_name, const signed long long &graph_id, eadlib::WeightedGraph<std::string> &graph );
+            bool loadGraphConcurrently( const std::string &graph_name, const signed long long &graph_id, eadlib::WeightedGraph<std::string> &graph );
+            bool switchBatchGraph( const std::string &graph_id );
+            bool flushNodes();
+            bool flushEdges();
+            bool flushAdjacency();
+            void clearBatches();
+            void finalizeInserts();
+            std::string buildInsertQuery( const std::string &table,
+                                          const std::string &columns,
+                                          const size_t &column_count,
+                                          const size_t &row_count ) const;
+            std::string buildParameterList( const size_t &count ) const;
             eadlib::wrapper::SQLite _database;
             std::string _graph_name;
+            bool _read_only;
+            //Batched insert buffers (statements declared after '_database' so they are finalized first)
+            std::string _batch_graph_id;
+            std::vector<NodeRow> _node_batch;
+            std::vector<EdgeRow> _edge_batch;
+            std::vector<AdjacencyRow> _adjacency_batch;
+            eadlib::wrapper::SQLiteStatement _node_insert;
+            eadlib::wrapper::SQLiteStatement _edge_insert;
+            eadlib::wrapper::SQLiteStatement _adjacency_insert;
         };
     }
 }
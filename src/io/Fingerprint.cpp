@@ -0,0 +1,53 @@
+#include "Fingerprint.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+constexpr uint64_t sbp::io::Fingerprint::FNV_OFFSET_BASIS;
+constexpr uint64_t sbp::io::Fingerprint::FNV_PRIME;
+
+/**
+ * Computes the fingerprint of an input file and pipeline parameters
+ * @param file_path   Input file path
+ * @param parameters  Pipeline parameters string (e.g.: "k=31")
+ * @param fingerprint Container for the fingerprint (16 hex digits)
+ * @return Success
+ */
+bool sbp::io::Fingerprint::compute( const std::string &file_path, const std::string &parameters, std::string &fingerprint ) {
+    std::ifstream file( file_path, std::ios::binary );
+    if( !file.is_open() ) {
+        LOG_ERROR( "[sbp::io::Fingerprint::compute( ", file_path, ", ", parameters, ", .. )] Could not open file." );
+        return false;
+    }
+    uint64_t value { FNV_OFFSET_BASIS };
+    std::vector<char> buffer( 1 << 20 );
+    while( file.read( buffer.data(), buffer.size() ) || file.gcount() > 0 ) {
+        value = hash( buffer.data(), static_cast<size_t>( file.gcount() ), value );
+    }
+    if( file.bad() ) {
+        LOG_ERROR( "[sbp::io::Fingerprint::compute( ", file_path, ", ", parameters, ", .. )] Problem reading file." );
+        return false;
+    }
+    value = hash( parameters.data(), parameters.size(), hash( "|", 1, value ) );
+    std::stringstream ss;
+    ss << std::hex << std::setw( 16 ) << std::setfill( '0' ) << value;
+    fingerprint = ss.str();
+    return true;
+}
+
+/**
+ * Hashes bytes with 64-bit FNV-1a
+ * @param data Bytes
+ * @param size Number of bytes
+ * @param seed Hash of any preceding bytes (offset basis to start)
+ * @return Hash value
+ */
+uint64_t sbp::io::Fingerprint::hash( const char *data, const size_t &size, uint64_t seed ) {
+    for( size_t i = 0; i < size; i++ ) {
+        seed ^= static_cast<unsigned char>( data[ i ] );
+        seed *= FNV_PRIME;
+    }
+    return seed;
+}
@@ -0,0 +1,35 @@
+/**
+    @class          sbp::io::Fingerprint
+    @brief          Content fingerprint of a pipeline input
+
+                    64-bit FNV-1a hash of the input file's bytes followed by the
+                    pipeline parameters that shape the graph built from it (e.g.:
+                    K-mer length). Two runs with the same fingerprint produce the
+                    same compressed/indexed graph so the stored one can be reused.
+
+    @dependencies   eadlib::logger::Logger
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2017
+    @license        GNUv2 Public License
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_FINGERPRINT_H
+#define SUPERBUBBLE_PERFORMANCE_FINGERPRINT_H
+
+#include <cstdint>
+#include <string>
+#include <eadlib/logger/Logger.h>
+
+namespace sbp {
+    namespace io {
+        class Fingerprint {
+          public:
+            static bool compute( const std::string &file_path, const std::string &parameters, std::string &fingerprint );
+            static uint64_t hash( const char *data, const size_t &size, uint64_t seed = FNV_OFFSET_BASIS );
+          private:
+            static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+            static constexpr uint64_t FNV_PRIME        = 1099511628211ULL;
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_FINGERPRINT_H
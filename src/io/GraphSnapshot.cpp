@@ -0,0 +1,500 @@
+#include "GraphSnapshot.h"
+
+#include <fstream>
+#include <limits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace {
+    const char SNAPSHOT_MAGIC[8] = { 'S', 'B', 'P', 'G', 'R', 'A', 'P', 'H' };
+
+    /**
+     * Adds the byte size of a section to a total without overflowing
+     * @param total Running byte total
+     * @param count Number of elements in the section
+     * @param width Byte size of an element
+     * @return Success (false on overflow)
+     */
+    bool addSectionSize( uint64_t &total, const uint64_t &count, const uint64_t &width ) {
+        if( count > ( std::numeric_limits<uint64_t>::max() - total ) / width ) {
+            return false;
+        }
+        total += count * width;
+        return true;
+    }
+
+    /**
+     * Checks that an offset table starts at 0, never decreases and ends on the size of the section it indexes
+     * @param offsets Offset table (count + 1 entries)
+     * @param count   Number of entries indexed (nodes)
+     * @param end     Size of the section indexed
+     * @return Valid state
+     */
+    bool isValidOffsetTable( const uint64_t *offsets, const uint64_t &count, const uint64_t &end ) {
+        if( offsets[ 0 ] != 0 || offsets[ count ] != end ) {
+            return false;
+        }
+        for( uint64_t i = 0; i < count; i++ ) {
+            if( offsets[ i ] > offsets[ i + 1 ] ) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+constexpr uint32_t sbp::io::GraphSnapshot::VERSION;
+constexpr uint32_t sbp::io::GraphSnapshot::FLAG_LABELS;
+
+/**
+ * Constructor
+ */
+sbp::io::GraphSnapshot::GraphSnapshot() :
+    _mapping( nullptr ),
+    _mapping_size( 0 ),
+    _header( nullptr ),
+    _offsets( nullptr ),
+    _targets( nullptr ),
+    _weights( nullptr ),
+    _label_offsets( nullptr ),
+    _labels( nullptr )
+{}
+
+/**
+ * Move-Constructor
+ * @param snapshot GraphSnapshot instance to move over
+ */
+sbp::io::GraphSnapshot::GraphSnapshot( sbp::io::GraphSnapshot &&snapshot ) noexcept :
+    _mapping( snapshot._mapping ),
+    _mapping_size( snapshot._mapping_size ),
+    _header( snapshot._header ),
+    _offsets( snapshot._offsets ),
+    _targets( snapshot._targets ),
+    _weights( snapshot._weights ),
+    _label_offsets( snapshot._label_offsets ),
+    _labels( snapshot._labels )
+{
+    snapshot._mapping = nullptr;
+    snapshot.close();
+}
+
+/**
+ * Destructor
+ */
+sbp::io::GraphSnapshot::~GraphSnapshot() {
+    close();
+}
+
+/**
+ * Move assignment operator
+ * @param rhs GraphSnapshot instance to move over
+ * @return Moved instance
+ */
+sbp::io::GraphSnapshot & sbp::io::GraphSnapshot::operator =( sbp::io::GraphSnapshot &&rhs ) noexcept {
+    if( this != &rhs ) {
+        close();
+        _mapping       = rhs._mapping;
+        _mapping_size  = rhs._mapping_size;
+        _header        = rhs._header;
+        _offsets       = rhs._offsets;
+        _targets       = rhs._targets;
+        _weights       = rhs._weights;
+        _label_offsets = rhs._label_offsets;
+        _labels        = rhs._labels;
+        rhs._mapping   = nullptr;
+        rhs.close();
+    }
+    return *this;
+}
+
+/**
+ * Writes a kmer string graph to a snapshot file
+ * (node IDs are the ones given on insertion into the graph like in the GraphIndexer and the kmers are stored as labels)
+ * @param file_name Snapshot file name
+ * @param graph     Kmer string graph (dense node IDs)
+ * @return Success
+ */
+bool sbp::io::GraphSnapshot::write( const std::string &file_name, const eadlib::WeightedGraph<std::string> &graph ) {
+    if( !graph.hasDenseNodeIDs() ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::write( ", file_name, ", <eadlib::WeightedGraph<std::string>> )] Graph node IDs are not dense." );
+        return false;
+    }
+    std::vector<const eadlib::WeightedGraph<std::string>::Graph_t::value_type *> nodes( graph.nodeCount(), nullptr );
+    for( const auto &node : graph ) {
+        nodes[ node.second.id ] = &node;
+    }
+    std::vector<uint64_t> label_offsets;
+    std::string           labels;
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> targets;
+    std::vector<uint64_t> weights;
+    label_offsets.reserve( graph.nodeCount() + 1 );
+    label_offsets.emplace_back( 0 );
+    offsets.reserve( graph.nodeCount() + 1 );
+    offsets.emplace_back( 0 );
+    for( const auto node : nodes ) {
+        labels += node->first;
+        label_offsets.emplace_back( labels.size() );
+        for( const auto &child : node->second.childrenList ) {
+            targets.emplace_back( graph.getNodeID( child ) );
+            weights.emplace_back( node->second.weight.at( child ) );
+        }
+        offsets.emplace_back( targets.size() );
+    }
+    return writeFile( file_name, offsets, targets, weights, &label_offsets, &labels );
+}
+
+/**
+ * Writes an index graph to a snapshot file
+ * (IDs are expected to be dense - any gap in [0, max ID] is stored as an isolated node)
+ * @param file_name Snapshot file name
+ * @param graph     Index graph
+ * @return Success
+ */
+bool sbp::io::GraphSnapshot::write( const std::string &file_name, const eadlib::WeightedGraph<size_t> &graph ) {
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> targets;
+    std::vector<uint64_t> weights;
+    buildCSR( graph, 0, offsets, targets, weights );
+    return writeFile( file_name, offsets, targets, weights, nullptr, nullptr );
+}
+
+/**
+ * Writes an index graph along with the kmer label of each node ID to a snapshot file
+ * @param file_name Snapshot file name
+ * @param graph     Index graph
+ * @param labels    Kmer string of each node ID
+ * @return Success
+ */
+bool sbp::io::GraphSnapshot::write( const std::string &file_name,
+                                    const eadlib::WeightedGraph<size_t> &graph,
+                                    const std::vector<std::string> &labels ) {
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> targets;
+    std::vector<uint64_t> weights;
+    buildCSR( graph, labels.size(), offsets, targets, weights );
+    if( offsets.size() - 1 != labels.size() ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::write( ", file_name, ", <WeightedGraph<size_t>>, <labels> )] Label count does not match the graph's node IDs." );
+        return false;
+    }
+    std::vector<uint64_t> label_offsets;
+    std::string           label_blob;
+    label_offsets.reserve( labels.size() + 1 );
+    label_offsets.emplace_back( 0 );
+    for( const auto &label : labels ) {
+        label_blob += label;
+        label_offsets.emplace_back( label_blob.size() );
+    }
+    return writeFile( file_name, offsets, targets, weights, &label_offsets, &label_blob );
+}
+
+/**
+ * Maps a snapshot file into memory
+ * (the sections are checked once here so that the graph can then be read from them without bound checks)
+ * @param file_name Snapshot file name
+ * @return Success
+ */
+bool sbp::io::GraphSnapshot::open( const std::string &file_name ) {
+    close();
+    int fd = ::open( file_name.c_str(), O_RDONLY );
+    if( fd < 0 ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] Could not open file." );
+        return false;
+    }
+    struct stat file_stat;
+    if( fstat( fd, &file_stat ) != 0 || static_cast<size_t>( file_stat.st_size ) < sizeof( Header ) ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] File is too small to be a snapshot." );
+        ::close( fd );
+        return false;
+    }
+    _mapping_size = static_cast<size_t>( file_stat.st_size );
+    _mapping      = mmap( nullptr, _mapping_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    ::close( fd );
+    if( _mapping == MAP_FAILED ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] Could not map file into memory." );
+        _mapping = nullptr;
+        close();
+        return false;
+    }
+    //Header checks
+    _header = static_cast<const Header *>( _mapping );
+    if( std::char_traits<char>::compare( _header->_magic, SNAPSHOT_MAGIC, sizeof( SNAPSHOT_MAGIC ) ) != 0 ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] File is not a graph snapshot." );
+        close();
+        return false;
+    }
+    if( _header->_version != VERSION ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] Unsupported snapshot version (", _header->_version, ")." );
+        close();
+        return false;
+    }
+    //Size checks (the counts come from the file so the arithmetic is guarded against overflow)
+    const auto node_count    = _header->_node_count;
+    const auto edge_count    = _header->_edge_count;
+    const bool has_labels    = ( _header->_flags & FLAG_LABELS ) != 0;
+    uint64_t   expected_size = sizeof( Header );
+    bool       valid_size    = node_count < std::numeric_limits<uint64_t>::max()
+                               && addSectionSize( expected_size, node_count + 1, sizeof( uint64_t ) )
+                               && addSectionSize( expected_size, edge_count, 2 * sizeof( uint64_t ) );
+    if( has_labels ) {
+        valid_size = valid_size
+                     && addSectionSize( expected_size, node_count + 1, sizeof( uint64_t ) )
+                     && addSectionSize( expected_size, _header->_label_bytes, sizeof( char ) );
+    }
+    if( !valid_size || expected_size != _mapping_size ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] File size does not match header (truncated?)." );
+        close();
+        return false;
+    }
+    //Section pointers
+    auto sections = reinterpret_cast<const uint64_t *>( static_cast<const char *>( _mapping ) + sizeof( Header ) );
+    _offsets = sections;
+    _targets = _offsets + node_count + 1;
+    _weights = _targets + edge_count;
+    if( has_labels ) {
+        _label_offsets = _weights + edge_count;
+        _labels        = reinterpret_cast<const char *>( _label_offsets + node_count + 1 );
+    }
+    //Content checks (so that nothing indexed through the sections can land outside of the mapping)
+    if( !isValidOffsetTable( _offsets, node_count, edge_count ) ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] Offset table is corrupted." );
+        close();
+        return false;
+    }
+    for( uint64_t e = 0; e < edge_count; e++ ) {
+        if( _targets[ e ] >= node_count ) {
+            LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] Edge target out of range (", _targets[ e ], ")." );
+            close();
+            return false;
+        }
+    }
+    if( has_labels && !isValidOffsetTable( _label_offsets, node_count, _header->_label_bytes ) ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::open( ", file_name, " )] Label offset table is corrupted." );
+        close();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Unmaps the snapshot (if any)
+ */
+void sbp::io::GraphSnapshot::close() {
+    if( _mapping != nullptr ) {
+        munmap( _mapping, _mapping_size );
+    }
+    _mapping       = nullptr;
+    _mapping_size  = 0;
+    _header        = nullptr;
+    _offsets       = nullptr;
+    _targets       = nullptr;
+    _weights       = nullptr;
+    _label_offsets = nullptr;
+    _labels        = nullptr;
+}
+
+/**
+ * Checks if a snapshot is mapped
+ * @return Open state
+ */
+bool sbp::io::GraphSnapshot::isOpen() const {
+    return _mapping != nullptr;
+}
+
+/**
+ * Gets the number of nodes in the snapshot
+ * @return Node count
+ */
+uint64_t sbp::io::GraphSnapshot::nodeCount() const {
+    return _header != nullptr ? _header->_node_count : 0;
+}
+
+/**
+ * Gets the number of unique edges in the snapshot
+ * @return Edge count
+ */
+uint64_t sbp::io::GraphSnapshot::edgeCount() const {
+    return _header != nullptr ? _header->_edge_count : 0;
+}
+
+/**
+ * Checks if the snapshot holds the kmer labels of the nodes
+ * @return Label state
+ */
+bool sbp::io::GraphSnapshot::hasLabels() const {
+    return _labels != nullptr;
+}
+
+/**
+ * Gets the CSR offsets (node i's edges are in [offsets[i], offsets[i+1]) of targets/weights)
+ * @return Pointer to the offsets array (node count + 1 entries)
+ */
+const uint64_t * sbp::io::GraphSnapshot::offsets() const {
+    return _offsets;
+}
+
+/**
+ * Gets the CSR edge targets
+ * @return Pointer to the targets array (edge count entries)
+ */
+const uint64_t * sbp::io::GraphSnapshot::targets() const {
+    return _targets;
+}
+
+/**
+ * Gets the CSR edge weights
+ * @return Pointer to the weights array (edge count entries)
+ */
+const uint64_t * sbp::io::GraphSnapshot::weights() const {
+    return _weights;
+}
+
+/**
+ * Gets the kmer label of a node
+ * @param node Node ID
+ * @return Kmer string (empty if no labels or invalid node)
+ */
+std::string sbp::io::GraphSnapshot::label( const uint64_t &node ) const {
+    if( !hasLabels() || node >= nodeCount() ) {
+        return "";
+    }
+    return std::string( _labels + _label_offsets[ node ], _labels + _label_offsets[ node + 1 ] );
+}
+
+/**
+ * Loads the snapshot into an index graph
+ * @param graph Index graph instance to load into
+ * @return Success
+ */
+bool sbp::io::GraphSnapshot::loadGraph( eadlib::WeightedGraph<size_t> &graph ) const {
+    if( !isOpen() ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::loadGraph( <WeightedGraph<size_t>> )] No snapshot opened." );
+        return false;
+    }
+    if( !graph.isEmpty() ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::loadGraph( <WeightedGraph<size_t>> )] WeightedGraph<size_t> instance not empty." );
+        return false;
+    }
+    for( uint64_t node = 0; node < nodeCount(); node++ ) {
+        graph.addNode( node );
+    }
+    for( uint64_t node = 0; node < nodeCount(); node++ ) {
+        for( uint64_t e = _offsets[ node ]; e < _offsets[ node + 1 ]; e++ ) {
+            graph.createDirectedEdge_fast( node, _targets[ e ], _weights[ e ] );
+        }
+    }
+    return true;
+}
+
+/**
+ * Loads the snapshot into a kmer string graph
+ * @param graph Kmer string graph instance to load into
+ * @return Success
+ */
+bool sbp::io::GraphSnapshot::loadGraph( eadlib::WeightedGraph<std::string> &graph ) const {
+    if( !isOpen() || !hasLabels() ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::loadGraph( <WeightedGraph<std::string>> )] No snapshot with kmer labels opened." );
+        return false;
+    }
+    if( !graph.isEmpty() ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::loadGraph( <WeightedGraph<std::string>> )] WeightedGraph<std::string> instance not empty." );
+        return false;
+    }
+    std::vector<std::string> kmers;
+    kmers.reserve( nodeCount() );
+    for( uint64_t node = 0; node < nodeCount(); node++ ) {
+        kmers.emplace_back( label( node ) );
+        graph.addNode( kmers.back() );
+    }
+    for( uint64_t node = 0; node < nodeCount(); node++ ) {
+        for( uint64_t e = _offsets[ node ]; e < _offsets[ node + 1 ]; e++ ) {
+            graph.createDirectedEdge_fast( kmers[ node ], kmers[ _targets[ e ] ], _weights[ e ] );
+        }
+    }
+    return true;
+}
+
+/**
+ * Builds the CSR arrays of an index graph
+ * @param graph          Index graph
+ * @param min_node_count Minimum number of nodes (IDs) to cover
+ * @param offsets        Container for the offsets
+ * @param targets        Container for the targets
+ * @param weights        Container for the weights
+ */
+void sbp::io::GraphSnapshot::buildCSR( const eadlib::WeightedGraph<size_t> &graph,
+                                       const size_t &min_node_count,
+                                       std::vector<uint64_t> &offsets,
+                                       std::vector<uint64_t> &targets,
+                                       std::vector<uint64_t> &weights ) {
+    size_t node_count { min_node_count };
+    for( const auto &node : graph ) {
+        node_count = std::max( node_count, node.first + 1 );
+    }
+    std::vector<const eadlib::WeightedGraph<size_t>::NodeAdjacency *> nodes( node_count, nullptr );
+    for( const auto &node : graph ) {
+        nodes[ node.first ] = &node.second;
+    }
+    offsets.clear();
+    targets.clear();
+    weights.clear();
+    offsets.reserve( node_count + 1 );
+    offsets.emplace_back( 0 );
+    for( const auto &adjacency : nodes ) {
+        if( adjacency != nullptr ) {
+            for( const auto &child : adjacency->childrenList ) {
+                targets.emplace_back( child );
+                weights.emplace_back( adjacency->weight.at( child ) );
+            }
+        }
+        offsets.emplace_back( targets.size() );
+    }
+}
+
+/**
+ * Writes the snapshot sections to file
+ * @param file_name     Snapshot file name
+ * @param offsets       CSR offsets
+ * @param targets       CSR targets
+ * @param weights       CSR weights
+ * @param label_offsets Label offsets (nullptr when no labels)
+ * @param labels        Concatenated labels (nullptr when no labels)
+ * @return Success
+ */
+bool sbp::io::GraphSnapshot::writeFile( const std::string &file_name,
+                                        const std::vector<uint64_t> &offsets,
+                                        const std::vector<uint64_t> &targets,
+                                        const std::vector<uint64_t> &weights,
+                                        const std::vector<uint64_t> *label_offsets,
+                                        const std::string *labels ) {
+    bool has_labels = ( label_offsets != nullptr && labels != nullptr );
+    Header header {};
+    std::char_traits<char>::copy( header._magic, SNAPSHOT_MAGIC, sizeof( SNAPSHOT_MAGIC ) );
+    header._version     = VERSION;
+    header._flags       = has_labels ? FLAG_LABELS : 0;
+    header._node_count  = offsets.size() - 1;
+    header._edge_count  = targets.size();
+    header._label_bytes = has_labels ? labels->size() : 0;
+    std::ofstream out( file_name, std::ios::binary | std::ios::trunc );
+    if( !out.is_open() ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::writeFile( ", file_name, ", .. )] Could not open file for writing." );
+        return false;
+    }
+    out.write( reinterpret_cast<const char *>( &header ), sizeof( Header ) );
+    out.write( reinterpret_cast<const char *>( offsets.data() ), offsets.size() * sizeof( uint64_t ) );
+    out.write( reinterpret_cast<const char *>( targets.data() ), targets.size() * sizeof( uint64_t ) );
+    out.write( reinterpret_cast<const char *>( weights.data() ), weights.size() * sizeof( uint64_t ) );
+    if( has_labels ) {
+        out.write( reinterpret_cast<const char *>( label_offsets->data() ), label_offsets->size() * sizeof( uint64_t ) );
+        out.write( labels->data(), labels->size() );
+    }
+    out.close();
+    if( out.fail() ) {
+        LOG_ERROR( "[sbp::io::GraphSnapshot::writeFile( ", file_name, ", .. )] Problem writing snapshot." );
+        return false;
+    }
+    LOG_DEBUG( "[sbp::io::GraphSnapshot::writeFile( ", file_name, ", .. )] Snapshot written (", header._node_count, " nodes, ", header._edge_count, " edges)." );
+    return true;
+}
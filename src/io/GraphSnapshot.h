@@ -0,0 +1,96 @@
+/**
+    @class          sbp::io::GraphSnapshot
+    @brief          Memory-mappable binary snapshot of an index graph
+
+                    File layout (native endianness, every section 8-byte aligned):
+                      Header         magic "SBPGRAPH", version, flags,
+                                     node count (N), edge count (E), label bytes (L)
+                      Offsets        uint64_t[ N + 1 ] (CSR row offsets into targets/weights)
+                      Targets        uint64_t[ E ]
+                      Weights        uint64_t[ E ]
+                      Label offsets  uint64_t[ N + 1 ] (only when FLAG_LABELS is set)
+                      Labels         char[ L ]         (only when FLAG_LABELS is set)
+
+                    Opening a snapshot maps the file read-only and points straight
+                    into it so the arrays can be used without any parsing. The sections
+                    are checked once when opened (sizes, offset tables and edge targets).
+
+    @dependencies   eadlib::WeightedGraph<T>, eadlib::logger::Logger
+    @author         E. A. Davison
+    @copyright      E. A. Davison 2017
+    @license        GNUv2 Public License
+**/
+#ifndef SUPERBUBBLE_PERFORMANCE_GRAPHSNAPSHOT_H
+#define SUPERBUBBLE_PERFORMANCE_GRAPHSNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <eadlib/logger/Logger.h>
+#include <eadlib/datastructure/WeightedGraph.h>
+
+namespace sbp {
+    namespace io {
+        class GraphSnapshot {
+          public:
+            static constexpr uint32_t VERSION     = 1;
+            static constexpr uint32_t FLAG_LABELS = 0x1;
+            GraphSnapshot();
+            GraphSnapshot( const GraphSnapshot &snapshot ) = delete;
+            GraphSnapshot( GraphSnapshot &&snapshot ) noexcept;
+            ~GraphSnapshot();
+            GraphSnapshot & operator =( const GraphSnapshot &rhs ) = delete;
+            GraphSnapshot & operator =( GraphSnapshot &&rhs ) noexcept;
+            //Writing
+            static bool write( const std::string &file_name, const eadlib::WeightedGraph<std::string> &graph );
+            static bool write( const std::string &file_name, const eadlib::WeightedGraph<size_t> &graph );
+            static bool write( const std::string &file_name,
+                               const eadlib::WeightedGraph<size_t> &graph,
+                               const std::vector<std::string> &labels );
+            //Reading
+            bool open( const std::string &file_name );
+            void close();
+            bool isOpen() const;
+            uint64_t nodeCount() const;
+            uint64_t edgeCount() const;
+            bool hasLabels() const;
+            const uint64_t * offsets() const;
+            const uint64_t * targets() const;
+            const uint64_t * weights() const;
+            std::string label( const uint64_t &node ) const;
+            bool loadGraph( eadlib::WeightedGraph<size_t> &graph ) const;
+            bool loadGraph( eadlib::WeightedGraph<std::string> &graph ) const;
+
+          private:
+            struct Header {
+                char     _magic[8];
+                uint32_t _version;
+                uint32_t _flags;
+                uint64_t _node_count;
+                uint64_t _edge_count;
+                uint64_t _label_bytes;
+            };
+            static void buildCSR( const eadlib::WeightedGraph<size_t> &graph,
+                                  const size_t &min_node_count,
+                                  std::vector<uint64_t> &offsets,
+                                  std::vector<uint64_t> &targets,
+                                  std::vector<uint64_t> &weights );
+            static bool writeFile( const std::string &file_name,
+                                   const std::vector<uint64_t> &offsets,
+                                   const std::vector<uint64_t> &targets,
+                                   const std::vector<uint64_t> &weights,
+                                   const std::vector<uint64_t> *label_offsets,
+                                   const std::string *labels );
+            void         * _mapping;
+            size_t         _mapping_size;
+            const Header * _header;
+            const uint64_t * _offsets;
+            const uint64_t * _targets;
+            const uint64_t * _weights;
+            const uint64_t * _label_offsets;
+            const char     * _labels;
+        };
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_GRAPHSNAPSHOT_H
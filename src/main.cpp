@@ -12,6 +12,7 @@ int main( int argc, char *argv[] ) {
     auto parser      = eadlib::cli::Parser( program_name );
     auto cli_options = sbp::cli::CliOptions( parser, argv );
     auto options     = sbp::cli::OptionContainer();
+    int  exit_status { 0 };
     try {
         if( cli_options.parse( argc, argv, options ) ) {
             //Option: List graphs in DB
@@ -40,33 +41,125 @@ int main( int argc, char *argv[] ) {
                 std::cerr << "Error: required option argument flags not set." << std::endl;
                 return -1;
             }
+            //Option: Append reads to a graph in DB
+            if( options.append_flag ) {
+                if( options.save_flag ) {
+                    std::cerr << "Error: Cannot both save and append to a graph. Please do one at a time." << std::endl;
+                    return -1;
+                }
+                auto runner = sbp::PipelineRunner();
+                if( !runner.appendToDB( options.db_name, options.graph_name, options.fasta_file, options.kmer_size ) ) {
+                    std::cerr << "Error: Could not append '" << options.fasta_file << "' to '" << options.graph_name << "' graph in DB." << std::endl;
+                    return -1;
+                }
+                return 0;
+            }
 
-            std::string graph_name = sbp::fileNameExtractor( options.fasta_file ); //"genome_01" //"test01" //"genome_02"
+            std::string graph_name = options.save_flag
+                                     ? options.graph_name
+                                     : sbp::fileNameExtractor( options.fasta_file ); //"genome_01" //"test01" //"genome_02"
             std::cout << "File path: " << options.fasta_file << std::endl;
             std::cout << "Graph name: " << graph_name << std::endl;
             std::string dot_file = graph_name + ".dot";
             std::string compressed_dot_file = graph_name + "_compressed.dot";
             std::string indexed_dot_file = graph_name + "_indexed.dot";
             std::string check_dot_file = graph_name + "_reconstructed.dot";
+            std::string snapshot_file = graph_name + ".sbg";
 
             auto runner = sbp::PipelineRunner();
-            auto kmer_graph = new eadlib::WeightedGraph<std::string>( graph_name );
-            //Stage 1 - Loading the sequencer reads
-            runner.loadFASTA( options.fasta_file, options.kmer_size, *kmer_graph );
-            runner.exportToDot( dot_file, *kmer_graph );
-            //Stage 2 - Compressing the graph
-            runner.compressGraph( *kmer_graph );
-            runner.exportToDot( compressed_dot_file, *kmer_graph );
-            //Stage 3 - Indexing and saving to database
-            runner.exportToDB( options.db_name, *kmer_graph );
-            delete kmer_graph;
-            //Stage 4 - Retrieving indexed version of the graph from the database
-            auto index_graph = new eadlib::WeightedGraph<size_t>( graph_name );
-            runner.importFromDB( options.db_name, *index_graph );
+            //Input fingerprint (FASTA content + parameters shaping the graph)
+            std::string fingerprint;
+            std::string parameters { "k=" + std::to_string( options.kmer_size ) + ";compress=1;order=" + std::to_string( options.order_flag ) };
+            if( !sbp::io::Fingerprint::compute( options.fasta_file, parameters, fingerprint ) ) {
+                std::cerr << "Error: Could not fingerprint '" << options.fasta_file << "'." << std::endl;
+            }
+            //Checkpoints (only usable when the input could be fingerprinted)
+            auto checkpoint = sbp::io::Checkpoint( graph_name, fingerprint );
+            bool checkpointing = options.checkpoint_flag && !fingerprint.empty();
+            eadlib::WeightedGraph<size_t> *index_graph { nullptr };
+            auto kmers     = std::vector<std::string>();
+            auto db_export = std::future<bool>();
+            bool resumed { false };
+            if( checkpointing ) {
+                index_graph = new eadlib::WeightedGraph<size_t>( graph_name );
+                resumed = runner.resumeIndexGraph( checkpoint, *index_graph, kmers );
+                if( !resumed ) {
+                    delete index_graph;
+                    index_graph = nullptr;
+                }
+            }
+            bool cached { false };
+            if( options.cache_flag && !resumed ) {
+                auto cached_graph_name = runner.findCachedGraph( options.db_name, fingerprint );
+                if( !cached_graph_name.empty() ) {
+                    //Stages 1 to 3 - Cached graph from the same input found in the database
+                    std::cout << "-> Cache: graph '" << cached_graph_name << "' was built from the same input (" << fingerprint << "), skipping the rebuild." << std::endl;
+                    index_graph = new eadlib::WeightedGraph<size_t>( cached_graph_name );
+                    cached = runner.importFromDB( options.db_name, *index_graph );
+                    if( cached ) {
+                        graph_name = cached_graph_name;
+                    } else {
+                        std::cerr << "Error: Could not load cached graph '" << cached_graph_name << "', rebuilding it." << std::endl;
+                        exit_status = -1;
+                        delete index_graph;
+                        index_graph = nullptr;
+                    }
+                }
+            }
+            if( resumed ) {
+                //Stages 1 to 3 - Indexed graph checkpointed from a previous run on the same input
+                auto schema = options.blob_flag ? sbp::io::StorageSchema::ADJACENCY_BLOB : sbp::io::StorageSchema::EDGE_ROWS;
+                db_export = runner.exportToDBAsync( options.db_name, snapshot_file, *index_graph, kmers, schema );
+            } else if( !cached ) {
+                auto kmer_graph = new eadlib::WeightedGraph<std::string>( graph_name );
+                //Stage 1 - Loading the sequencer reads
+                runner.loadFASTA( options.fasta_file, options.kmer_size, *kmer_graph );
+                runner.exportToDot( dot_file, *kmer_graph );
+                //Stage 2 - Compressing the graph
+                runner.compressGraph( *kmer_graph );
+                runner.exportToDot( compressed_dot_file, *kmer_graph );
+                if( options.order_flag ) {
+                    runner.reorderGraph( *kmer_graph );
+                }
+                //Stage 3 - Indexing in memory (+ saving to database in the background)
+                index_graph = new eadlib::WeightedGraph<size_t>( graph_name );
+                runner.indexGraph( *kmer_graph, *index_graph, kmers );
+                delete kmer_graph;
+                if( checkpointing ) {
+                    runner.checkpointIndexGraph( checkpoint, *index_graph, kmers );
+                }
+                auto schema = options.blob_flag ? sbp::io::StorageSchema::ADJACENCY_BLOB : sbp::io::StorageSchema::EDGE_ROWS;
+                db_export = runner.exportToDBAsync( options.db_name, snapshot_file, *index_graph, kmers, schema );
+            }
+            //Stage 4 - Running the superbubble algorithm(s) on the indexed graph
             runner.exportToDot( indexed_dot_file, *index_graph );
-            runner.runSuperbubble( *index_graph );
+            if( options.sb1 ) {
+                auto detected = checkpointing
+                                ? runner.runQLinearSuperbubble( *index_graph, checkpoint )
+                                : runner.runQLinearSuperbubble( *index_graph );
+                if( !detected ) {
+                    exit_status = -1;
+                }
+            }
+            if( options.sb2 && !runner.runLinearSuperbubble( *index_graph ) ) {
+                exit_status = -1;
+            }
+            if( options.sb3 && !runner.runQuadraticSuperbubble( *index_graph ) ) {
+                exit_status = -1;
+            }
+            if( options.sb4 && !runner.runDominatorSuperbubble( *index_graph ) ) {
+                exit_status = -1;
+            }
+            if( db_export.valid() ) {
+                if( db_export.get() ) {
+                    std::cout << "-> Stored graph '" << graph_name << "' into the database." << std::endl;
+                    runner.recordFingerprint( options.db_name, graph_name, fingerprint );
+                } else {
+                    std::cerr << "Error: Could not save '" << graph_name << "' graph to DB." << std::endl;
+                }
+            }
             delete index_graph;
-            //Stage 5 - Reconstructing the kmer graph
+            //Stage 5 - Reconstructing the kmer graph from the database
             auto reconstructed_kmer_graph = new eadlib::WeightedGraph<std::string>( graph_name );
             runner.importFromDB( options.db_name, *reconstructed_kmer_graph );
             runner.exportToDot( check_dot_file, *reconstructed_kmer_graph );
@@ -77,7 +170,7 @@ int main( int argc, char *argv[] ) {
     } catch( std::regex_error e ) {
         std::cerr << "Malformed regular expression detected in parser option." << std::endl;
     }
-    return 0;
+    return exit_status;
 }
 
 /**
@@ -0,0 +1,55 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_ADJACENCYCODEC_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_ADJACENCYCODEC_TEST_H
+
+#include "gtest/gtest.h"
+#include "../src/io/AdjacencyCodec.h"
+
+TEST( AdjacencyCodec_Tests, Children_roundtrip ) {
+    auto children = sbp::io::AdjacencyCodec::Children_t( { { 1000000, 3 }, { 2, 1 }, { 500, 300 }, { 499, 1 } } );
+    std::string blob;
+    sbp::io::AdjacencyCodec::encodeChildren( 500, children, blob );
+    auto decoded = sbp::io::AdjacencyCodec::Children_t();
+    ASSERT_TRUE( sbp::io::AdjacencyCodec::decodeChildren( 500,
+                                                          reinterpret_cast<const unsigned char *>( blob.data() ),
+                                                          blob.size(),
+                                                          decoded ) );
+    auto expected = sbp::io::AdjacencyCodec::Children_t( { { 2, 1 }, { 499, 1 }, { 500, 300 }, { 1000000, 3 } } );
+    ASSERT_EQ( expected, decoded );
+}
+
+TEST( AdjacencyCodec_Tests, Children_empty ) {
+    auto children = sbp::io::AdjacencyCodec::Children_t();
+    std::string blob;
+    sbp::io::AdjacencyCodec::encodeChildren( 7, children, blob );
+    ASSERT_EQ( 1, blob.size() );
+    auto decoded = sbp::io::AdjacencyCodec::Children_t( { { 1, 1 } } );
+    ASSERT_TRUE( sbp::io::AdjacencyCodec::decodeChildren( 7, reinterpret_cast<const unsigned char *>( blob.data() ), blob.size(), decoded ) );
+    ASSERT_TRUE( decoded.empty() );
+}
+
+TEST( AdjacencyCodec_Tests, Children_truncated ) {
+    auto children = sbp::io::AdjacencyCodec::Children_t( { { 1, 200 }, { 5, 1 } } );
+    std::string blob;
+    sbp::io::AdjacencyCodec::encodeChildren( 0, children, blob );
+    auto decoded = sbp::io::AdjacencyCodec::Children_t();
+    ASSERT_FALSE( sbp::io::AdjacencyCodec::decodeChildren( 0, reinterpret_cast<const unsigned char *>( blob.data() ), blob.size() - 1, decoded ) );
+}
+
+TEST( AdjacencyCodec_Tests, Kmer_roundtrip ) {
+    for( std::string kmer : { "A", "ACGT", "TTTTG", "GATTACAGATTACA", "" } ) {
+        std::string blob;
+        std::string decoded;
+        ASSERT_TRUE( sbp::io::AdjacencyCodec::packKmer( kmer, blob ) );
+        ASSERT_TRUE( sbp::io::AdjacencyCodec::unpackKmer( reinterpret_cast<const unsigned char *>( blob.data() ), blob.size(), decoded ) );
+        ASSERT_EQ( kmer, decoded );
+    }
+}
+
+TEST( AdjacencyCodec_Tests, Kmer_not_packable ) {
+    std::string blob;
+    ASSERT_FALSE( sbp::io::AdjacencyCodec::packKmer( "a_long", blob ) );
+    ASSERT_FALSE( sbp::io::AdjacencyCodec::packKmer( "ACGN", blob ) );
+    ASSERT_TRUE( blob.empty() );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_ADJACENCYCODEC_TEST_H
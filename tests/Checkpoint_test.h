@@ -0,0 +1,124 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_CHECKPOINT_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_CHECKPOINT_TEST_H
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <eadlib/datastructure/WeightedGraph.h>
+#include "../src/io/Checkpoint.h"
+#include "../src/algorithm/Tarjan.h"
+#include "../src/algorithm/PartitionGraph.h"
+#include "../src/algorithm/GraphToDAG.h"
+
+TEST( Checkpoint_Tests, IndexGraph_roundtrip ) {
+    auto checkpoint = sbp::io::Checkpoint( "Checkpoint_test1", "0123456789abcdef" );
+    checkpoint.clear();
+    auto graph = eadlib::WeightedGraph<size_t>( "Checkpoint_test" );
+    graph.createDirectedEdge_fast( 0, 1, 2 );
+    graph.createDirectedEdge_fast( 1, 2, 1 );
+    graph.createDirectedEdge_fast( 1, 3, 5 );
+    graph.createDirectedEdge_fast( 3, 0, 1 );
+    graph.addNode( 4 );
+    auto kmers = std::vector<std::string>( { "AAC", "ACG", "CGT", "GTA", "TTT" } );
+    ASSERT_EQ( sbp::io::Checkpoint::Stage::NONE, checkpoint.latest() );
+    ASSERT_TRUE( checkpoint.save( graph, kmers ) );
+    ASSERT_EQ( sbp::io::Checkpoint::Stage::INDEX_GRAPH, checkpoint.latest() );
+    auto loaded       = eadlib::WeightedGraph<size_t>( "Checkpoint_test" );
+    auto loaded_kmers = std::vector<std::string>();
+    ASSERT_TRUE( checkpoint.load( loaded, loaded_kmers ) );
+    ASSERT_EQ( graph.nodeCount(), loaded.nodeCount() );
+    ASSERT_EQ( graph.size(), loaded.size() );
+    ASSERT_EQ( kmers, loaded_kmers );
+    for( auto node : graph ) {
+        for( auto child : node.second.childrenList ) {
+            ASSERT_TRUE( loaded.edgeExists( node.first, child ) );
+            ASSERT_EQ( node.second.weight.at( child ), loaded.at( node.first ).weight.at( child ) );
+        }
+    }
+    checkpoint.clear();
+}
+
+TEST( Checkpoint_Tests, Stages_roundtrip ) {
+    auto checkpoint = sbp::io::Checkpoint( "Checkpoint_test2", "0123456789abcdef" );
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 0, 5 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 6 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 5 );
+    g.createDirectedEdge_fast( 4, 1 );
+    g.createDirectedEdge_fast( 5, 6 );
+    g.createDirectedEdge_fast( 6, 7 );
+    auto found_SCCs   = sbp::algo::Tarjan( g ).findSCCs();
+    auto sub_graphs   = sbp::algo::PartitionGraph().partitionSCCs( g, *found_SCCs, "SubGraph" );
+    sub_graphs->erase( sub_graphs->begin() ); //singleton SCCs sub-graph
+    auto dag_packages = sbp::algo::GraphToDAG().convertToDAG( *sub_graphs, "DAG" );
+    ASSERT_TRUE( checkpoint.save( *found_SCCs ) );
+    ASSERT_TRUE( checkpoint.save( *sub_graphs ) );
+    ASSERT_TRUE( checkpoint.save( *dag_packages ) );
+    ASSERT_EQ( sbp::io::Checkpoint::Stage::DAG_PACKAGES, checkpoint.latest() );
+    //SCCs
+    auto loaded_SCCs = std::list<std::list<size_t>>();
+    ASSERT_TRUE( checkpoint.load( loaded_SCCs ) );
+    ASSERT_EQ( *found_SCCs, loaded_SCCs );
+    //SubGraphs
+    auto loaded_sub_graphs = sbp::algo::PartitionGraph::SubGraphList_t();
+    ASSERT_TRUE( checkpoint.load( loaded_sub_graphs ) );
+    ASSERT_EQ( sub_graphs->size(), loaded_sub_graphs.size() );
+    for( auto a = sub_graphs->begin(), b = loaded_sub_graphs.begin(); a != sub_graphs->end(); ++a, ++b ) {
+        ASSERT_EQ( a->getName(), b->getName() );
+        ASSERT_EQ( a->nodeCount(), b->nodeCount() );
+        ASSERT_EQ( a->size(), b->size() );
+        for( size_t local = 0; local < a->nodeCount(); local++ ) {
+            if( local > 1 ) {
+                ASSERT_EQ( a->getGlobalID( local ), b->getGlobalID( local ) );
+            }
+            ASSERT_EQ( a->at( local ).childrenList, b->at( local ).childrenList );
+        }
+    }
+    //DAGs
+    auto loaded_dags = sbp::algo::GraphToDAG::DAG_List_t();
+    ASSERT_TRUE( checkpoint.load( loaded_dags ) );
+    ASSERT_EQ( dag_packages->size(), loaded_dags.size() );
+    for( auto a = dag_packages->begin(), b = loaded_dags.begin(); a != dag_packages->end(); ++a, ++b ) {
+        ASSERT_EQ( a->_dag.getName(), b->_dag.getName() );
+        ASSERT_EQ( a->_dag.nodeCount(), b->_dag.nodeCount() );
+        ASSERT_EQ( a->_dag.size(), b->_dag.size() );
+        ASSERT_EQ( a->_dag.getUniqueNodeCount(), b->_dag.getUniqueNodeCount() );
+        for( size_t local = 2; local < a->_dag.nodeCount(); local++ ) {
+            ASSERT_EQ( a->_dag.getGlobalID( local ), b->_dag.getGlobalID( local ) );
+            ASSERT_EQ( a->_dag.at( local ).childrenList, b->_dag.at( local ).childrenList );
+        }
+        ASSERT_EQ( a->_discovery_times, b->_discovery_times );
+        ASSERT_EQ( a->_finish_times, b->_finish_times );
+    }
+    checkpoint.clear();
+}
+
+TEST( Checkpoint_Tests, Validation ) {
+    auto checkpoint = sbp::io::Checkpoint( "Checkpoint_test3", "0123456789abcdef" );
+    auto scc_list   = std::list<std::list<size_t>>( { { 0 }, { 1, 2, 3 } } );
+    ASSERT_TRUE( checkpoint.save( scc_list ) );
+    ASSERT_TRUE( checkpoint.isValid( sbp::io::Checkpoint::Stage::SCC_LIST ) );
+    //Different input
+    auto other = sbp::io::Checkpoint( "Checkpoint_test3", "fedcba9876543210" );
+    ASSERT_FALSE( other.isValid( sbp::io::Checkpoint::Stage::SCC_LIST ) );
+    auto loaded = std::list<std::list<size_t>>();
+    ASSERT_FALSE( other.load( loaded ) );
+    //Corrupted payload
+    {
+        std::fstream file( checkpoint.getFileName( sbp::io::Checkpoint::Stage::SCC_LIST ), std::ios::in | std::ios::out | std::ios::binary );
+        file.seekp( -1, std::ios::end );
+        file.put( 'x' );
+    }
+    ASSERT_FALSE( checkpoint.isValid( sbp::io::Checkpoint::Stage::SCC_LIST ) );
+    //Invalid fingerprint
+    auto unfingerprinted = sbp::io::Checkpoint( "Checkpoint_test3", "" );
+    ASSERT_FALSE( unfingerprinted.save( scc_list ) );
+    checkpoint.clear();
+    ASSERT_EQ( sbp::io::Checkpoint::Stage::NONE, checkpoint.latest() );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_CHECKPOINT_TEST_H
@@ -0,0 +1,91 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_DATABASE_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_DATABASE_TEST_H
+
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <random>
+#include <eadlib/datastructure/WeightedGraph.h>
+#include "../src/io/Database.h"
+#include "../src/graph/GraphIndexer.h"
+
+/**
+ * Stores an index graph and its kmers into a fresh database file with the row-per-edge schema
+ */
+void store_Database_test_graph( const std::string &file_name,
+                                const eadlib::WeightedGraph<size_t> &index_graph,
+                                const std::vector<std::string> &kmers ) {
+    std::remove( file_name.c_str() );
+    auto db = sbp::io::Database();
+    ASSERT_TRUE( db.open( file_name ) );
+    auto indexer = sbp::graph::GraphIndexer( db );
+    ASSERT_TRUE( indexer.storeIntoDB( "Database_test", index_graph, kmers ) );
+    db.close();
+}
+
+TEST( Database_Tests, loadGraph_read_only ) {
+    //Random kmer graph big enough for edges to arrive before their kmers on the concurrent path
+    auto index_graph = eadlib::WeightedGraph<size_t>( "Database_test" );
+    auto kmers       = std::vector<std::string>();
+    std::mt19937 generator( 42 );
+    for( size_t i = 0; i < 20000; i++ ) {
+        std::string kmer( 21, 'A' );
+        for( auto &c : kmer ) {
+            c = "ACGT"[ generator() % 4 ];
+        }
+        kmers.emplace_back( kmer );
+        index_graph.addNode( i );
+    }
+    for( size_t i = 0; i < kmers.size(); i++ ) {
+        index_graph.createDirectedEdge_fast( i, generator() % kmers.size(), generator() % 5 + 1 );
+        index_graph.createDirectedEdge_fast( generator() % kmers.size(), i, generator() % 5 + 1 );
+    }
+    store_Database_test_graph( "Database_test1.db", index_graph, kmers );
+    //Serial load
+    auto db = sbp::io::Database();
+    ASSERT_TRUE( db.open( "Database_test1.db" ) );
+    auto serial = eadlib::WeightedGraph<std::string>( "serial" );
+    ASSERT_TRUE( db.loadGraph( "Database_test", serial ) );
+    db.close();
+    //Concurrent load
+    ASSERT_TRUE( db.openReadOnly( "Database_test1.db" ) );
+    auto concurrent = eadlib::WeightedGraph<std::string>( "concurrent" );
+    ASSERT_TRUE( db.loadGraph( "Database_test", concurrent ) );
+    db.close();
+    ASSERT_EQ( index_graph.size(), serial.size() );
+    ASSERT_EQ( serial.nodeCount(), concurrent.nodeCount() );
+    ASSERT_EQ( serial.size(), concurrent.size() );
+    for( auto node : serial ) {
+        for( auto child : node.second.childrenList ) {
+            ASSERT_TRUE( concurrent.edgeExists( node.first, child ) );
+            ASSERT_EQ( node.second.weight.at( child ), concurrent.at( node.first ).weight.at( child ) );
+        }
+    }
+}
+
+TEST( Database_Tests, loadGraph_no_edges ) {
+    auto index_graph = eadlib::WeightedGraph<size_t>( "Database_test" );
+    auto kmers       = std::vector<std::string>( { "AAC", "ACG", "CGT" } );
+    for( size_t i = 0; i < kmers.size(); i++ ) {
+        index_graph.addNode( i );
+    }
+    store_Database_test_graph( "Database_test2.db", index_graph, kmers );
+    auto db = sbp::io::Database();
+    ASSERT_TRUE( db.open( "Database_test2.db" ) );
+    auto serial = eadlib::WeightedGraph<std::string>( "serial" );
+    ASSERT_TRUE( db.loadGraph( "Database_test", serial ) );
+    db.close();
+    ASSERT_TRUE( db.openReadOnly( "Database_test2.db" ) );
+    auto concurrent = eadlib::WeightedGraph<std::string>( "concurrent" );
+    ASSERT_TRUE( db.loadGraph( "Database_test", concurrent ) );
+    db.close();
+    ASSERT_EQ( 0, serial.size() );
+    ASSERT_EQ( 0, concurrent.size() );
+    //Index graph (cache hit path)
+    ASSERT_TRUE( db.open( "Database_test2.db" ) );
+    auto indexed = eadlib::WeightedGraph<size_t>( "indexed" );
+    ASSERT_TRUE( db.loadGraph( "Database_test", indexed ) );
+    db.close();
+    ASSERT_EQ( 0, indexed.size() );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_DATABASE_TEST_H
@@ -0,0 +1,29 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_FINGERPRINT_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_FINGERPRINT_TEST_H
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include "../src/io/Fingerprint.h"
+
+TEST( Fingerprint_Tests, hash_FNV1a ) {
+    ASSERT_EQ( 0xcbf29ce484222325ULL, sbp::io::Fingerprint::hash( "", 0 ) );
+    ASSERT_EQ( 0xaf63dc4c8601ec8cULL, sbp::io::Fingerprint::hash( "a", 1 ) );
+    ASSERT_EQ( 0x85944171f73967e8ULL, sbp::io::Fingerprint::hash( "foobar", 6 ) );
+}
+
+TEST( Fingerprint_Tests, compute ) {
+    std::ofstream( "Fingerprint_test1.fasta" ) << ">read1\nACGTACGTAC\n";
+    std::ofstream( "Fingerprint_test2.fasta" ) << ">read1\nACGTACGTAG\n";
+    std::string a, b, c, d;
+    ASSERT_TRUE( sbp::io::Fingerprint::compute( "Fingerprint_test1.fasta", "k=5", a ) );
+    ASSERT_TRUE( sbp::io::Fingerprint::compute( "Fingerprint_test1.fasta", "k=5", b ) );
+    ASSERT_TRUE( sbp::io::Fingerprint::compute( "Fingerprint_test1.fasta", "k=6", c ) );
+    ASSERT_TRUE( sbp::io::Fingerprint::compute( "Fingerprint_test2.fasta", "k=5", d ) );
+    ASSERT_EQ( 16, a.size() );
+    ASSERT_EQ( a, b );
+    ASSERT_NE( a, c );
+    ASSERT_NE( a, d );
+    ASSERT_FALSE( sbp::io::Fingerprint::compute( "Fingerprint_test_missing.fasta", "k=5", a ) );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_FINGERPRINT_TEST_H
@@ -0,0 +1,37 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_GRAPHCOMPRESSOR_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_GRAPHCOMPRESSOR_TEST_H
+
+#include "gtest/gtest.h"
+#include "../src/algorithm/GraphCompressor.h"
+
+TEST( GraphCompressor_Tests, NodeIDs_insertion_order ) {
+    auto graph = eadlib::WeightedGraph<std::string>();
+    graph.createDirectedEdge_fast( "AAC", "ACG" );
+    graph.createDirectedEdge_fast( "ACG", "CGT" );
+    graph.addNode( "AAC" );
+    ASSERT_EQ( 0, graph.getNodeID( "AAC" ) );
+    ASSERT_EQ( 1, graph.getNodeID( "ACG" ) );
+    ASSERT_EQ( 2, graph.getNodeID( "CGT" ) );
+    ASSERT_TRUE( graph.hasDenseNodeIDs() );
+    ASSERT_THROW( graph.getNodeID( "TTT" ), std::out_of_range );
+}
+
+TEST( GraphCompressor_Tests, NodeIDs_dense_after_compression ) {
+    auto graph = eadlib::WeightedGraph<std::string>();
+    graph.createDirectedEdge_fast( "_a_l", "a_lo" );
+    graph.createDirectedEdge_fast( "a_lo", "_lon" );
+    graph.createDirectedEdge_fast( "_lon", "long" );
+    graph.createDirectedEdge_fast( "long", "ong_" );
+    graph.createDirectedEdge_fast( "long", "ongs" );
+    auto compressor = sbp::algo::GraphCompressor( graph );
+    compressor.compress();
+    ASSERT_TRUE( graph.hasDenseNodeIDs() );
+    auto seen = std::vector<bool>( graph.nodeCount(), false );
+    for( const auto &node : graph ) {
+        ASSERT_LT( node.second.id, graph.nodeCount() );
+        ASSERT_FALSE( seen[ node.second.id ] );
+        seen[ node.second.id ] = true;
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_GRAPHCOMPRESSOR_TEST_H
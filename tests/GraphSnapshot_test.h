@@ -0,0 +1,97 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_GRAPHSNAPSHOT_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_GRAPHSNAPSHOT_TEST_H
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iterator>
+#include <eadlib/datastructure/WeightedGraph.h>
+#include "../src/io/GraphSnapshot.h"
+
+TEST( GraphSnapshot_Tests, IndexGraph_roundtrip ) {
+    auto graph = eadlib::WeightedGraph<size_t>( "Snapshot_test" );
+    graph.createDirectedEdge_fast( 0, 1, 2 );
+    graph.createDirectedEdge_fast( 1, 2, 1 );
+    graph.createDirectedEdge_fast( 1, 3, 5 );
+    graph.createDirectedEdge_fast( 3, 0, 1 );
+    graph.addNode( 4 );
+    ASSERT_TRUE( sbp::io::GraphSnapshot::write( "GraphSnapshot_test1.sbg", graph ) );
+    auto snapshot = sbp::io::GraphSnapshot();
+    ASSERT_TRUE( snapshot.open( "GraphSnapshot_test1.sbg" ) );
+    ASSERT_EQ( 5, snapshot.nodeCount() );
+    ASSERT_EQ( 4, snapshot.edgeCount() );
+    ASSERT_FALSE( snapshot.hasLabels() );
+    ASSERT_EQ( 0, snapshot.offsets()[ 0 ] );
+    ASSERT_EQ( 1, snapshot.offsets()[ 1 ] );
+    ASSERT_EQ( 3, snapshot.offsets()[ 2 ] );
+    ASSERT_EQ( 1, snapshot.targets()[ 0 ] );
+    ASSERT_EQ( 2, snapshot.weights()[ 0 ] );
+    auto loaded = eadlib::WeightedGraph<size_t>( "Snapshot_test" );
+    ASSERT_TRUE( snapshot.loadGraph( loaded ) );
+    ASSERT_EQ( graph.nodeCount(), loaded.nodeCount() );
+    ASSERT_EQ( graph.size(), loaded.size() );
+    for( auto node : graph ) {
+        for( auto child : node.second.childrenList ) {
+            ASSERT_TRUE( loaded.edgeExists( node.first, child ) );
+            ASSERT_EQ( node.second.weight.at( child ), loaded.at( node.first ).weight.at( child ) );
+        }
+    }
+}
+
+TEST( GraphSnapshot_Tests, KmerGraph_roundtrip ) {
+    auto graph = eadlib::WeightedGraph<std::string>( "Snapshot_test" );
+    graph.createDirectedEdge_fast( "a_lon", "_long", 1 );
+    graph.createDirectedEdge_fast( "_long", "long_", 3 );
+    graph.createDirectedEdge_fast( "long_", "ong_lon", 2 );
+    graph.createDirectedEdge_fast( "long_", "ong_time", 1 );
+    graph.createDirectedEdge_fast( "ong_lon", "_long", 2 );
+    ASSERT_TRUE( sbp::io::GraphSnapshot::write( "GraphSnapshot_test2.sbg", graph ) );
+    auto snapshot = sbp::io::GraphSnapshot();
+    ASSERT_TRUE( snapshot.open( "GraphSnapshot_test2.sbg" ) );
+    ASSERT_TRUE( snapshot.hasLabels() );
+    ASSERT_EQ( 5, snapshot.nodeCount() );
+    ASSERT_EQ( 5, snapshot.edgeCount() );
+    auto loaded = eadlib::WeightedGraph<std::string>( "Snapshot_test" );
+    ASSERT_TRUE( snapshot.loadGraph( loaded ) );
+    ASSERT_EQ( graph.nodeCount(), loaded.nodeCount() );
+    ASSERT_EQ( graph.size(), loaded.size() );
+    ASSERT_EQ( 3, loaded.at( "_long" ).weight.at( "long_" ) );
+    ASSERT_EQ( 2, loaded.at( "ong_lon" ).weight.at( "_long" ) );
+}
+
+TEST( GraphSnapshot_Tests, Open_fail ) {
+    auto snapshot = sbp::io::GraphSnapshot();
+    ASSERT_FALSE( snapshot.open( "GraphSnapshot_missing.sbg" ) );
+    ASSERT_FALSE( snapshot.isOpen() );
+    ASSERT_EQ( 0, snapshot.nodeCount() );
+}
+
+TEST( GraphSnapshot_Tests, Open_corrupted ) {
+    //Header is 40 bytes then (5 nodes, 5 edges): offsets @40, targets @88, weights @128, label offsets @168, labels @216
+    auto graph = eadlib::WeightedGraph<std::string>( "Snapshot_test" );
+    graph.createDirectedEdge_fast( "a_lon", "_long", 1 );
+    graph.createDirectedEdge_fast( "_long", "long_", 3 );
+    graph.createDirectedEdge_fast( "long_", "ong_lon", 2 );
+    graph.createDirectedEdge_fast( "long_", "ong_time", 1 );
+    graph.createDirectedEdge_fast( "ong_lon", "_long", 2 );
+    ASSERT_TRUE( sbp::io::GraphSnapshot::write( "GraphSnapshot_test3.sbg", graph ) );
+    auto patch = []( const std::streamoff &position, const uint64_t &value ) {
+        std::ifstream in( "GraphSnapshot_test3.sbg", std::ios::binary );
+        std::string   bytes( ( std::istreambuf_iterator<char>( in ) ), std::istreambuf_iterator<char>() );
+        bytes.replace( static_cast<size_t>( position ), sizeof( uint64_t ), reinterpret_cast<const char *>( &value ), sizeof( uint64_t ) );
+        std::ofstream out( "GraphSnapshot_test4.sbg", std::ios::binary | std::ios::trunc );
+        out.write( bytes.data(), bytes.size() );
+    };
+    auto snapshot = sbp::io::GraphSnapshot();
+    ASSERT_TRUE( snapshot.open( "GraphSnapshot_test3.sbg" ) );
+    patch( 16, 0x2000000000000000 ); //node count: ( N + 1 ) * 8 overflows
+    ASSERT_FALSE( snapshot.open( "GraphSnapshot_test4.sbg" ) );
+    patch( 48, 4 );                  //offsets[1] > offsets[2]
+    ASSERT_FALSE( snapshot.open( "GraphSnapshot_test4.sbg" ) );
+    patch( 88, 5 );                  //targets[0] == N
+    ASSERT_FALSE( snapshot.open( "GraphSnapshot_test4.sbg" ) );
+    patch( 208, 0 );                 //label offsets[N] != L
+    ASSERT_FALSE( snapshot.open( "GraphSnapshot_test4.sbg" ) );
+    ASSERT_FALSE( snapshot.isOpen() );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_GRAPHSNAPSHOT_TEST_H
@@ -81,4 +81,89 @@ TEST( GraphToDAG_Tests, Test02 ) {
 
 }
 
+TEST( GraphToDAG_Tests, SubGraphView ) {
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 0, 2 );
+    g.createDirectedEdge_fast( 1, 3 );
+    g.createDirectedEdge_fast( 2, 1 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 3, 0 );
+    g.createDirectedEdge_fast( 3, 4 );
+    auto found_SCCs   = sbp::algo::Tarjan( g ).findSCCs();
+    auto views        = sbp::algo::PartitionGraph().viewSCCs( g, *found_SCCs, "Test03_SubGraph" );
+    auto dag_packages = sbp::algo::GraphToDAG().convertToDAG( *views, "Test03_DAG" );
+    ASSERT_EQ( views->size(), dag_packages->size() );
+    auto view = views->begin();
+    for( auto it = dag_packages->begin(); it != dag_packages->end(); ++it, ++view ) {
+        //every node is duplicated between r and r'
+        ASSERT_EQ( 2 * view->nodeCount() - 2, it->_dag.nodeCount() );
+        ASSERT_EQ( view->nodeCount(), it->_dag.getUniqueNodeCount() );
+    }
+}
+
+TEST( GraphToDAG_Tests, ImplicitDAG ) {
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 0, 5 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 6 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 5 );
+    g.createDirectedEdge_fast( 4, 1 );
+    g.createDirectedEdge_fast( 5, 6 );
+    g.createDirectedEdge_fast( 6, 7 );
+    auto found_SCCs = sbp::algo::Tarjan( g ).findSCCs();
+    auto sub_graphs = sbp::algo::PartitionGraph().partitionSCCs( g, *found_SCCs, "Test04_SubGraph" );
+    for( const auto &sub_graph : *sub_graphs ) {
+        auto explicit_dag = sbp::algo::GraphToDAG().convert( sub_graph, "Test04_DAG" );
+        auto implicit_dag = sbp::algo::GraphToDAG().convertImplicit( sub_graph, "Test04_DAG" );
+        const auto &dag      = explicit_dag->front()._dag;
+        const auto &implicit = implicit_dag->_dag;
+        ASSERT_EQ( dag.nodeCount(), implicit.nodeCount() );
+        ASSERT_EQ( dag.getUniqueNodeCount(), implicit.getUniqueNodeCount() );
+        ASSERT_EQ( explicit_dag->front()._discovery_times, implicit_dag->_discovery_times );
+        ASSERT_EQ( explicit_dag->front()._finish_times, implicit_dag->_finish_times );
+        for( size_t v = 0; v < implicit.nodeCount(); v++ ) {
+            auto node = implicit.at( v );
+            ASSERT_EQ( dag.getOutDegree( v ), implicit.getOutDegree( v ) );
+            ASSERT_EQ( dag.getInDegree( v ), implicit.getInDegree( v ) );
+            for( auto child : node.childrenList ) {
+                ASSERT_TRUE( dag.edgeExists( v, child ) );
+            }
+            if( v > 1 ) {
+                ASSERT_EQ( implicit.getGlobalID( v ), implicit.isDuplicate( v ) ? v - implicit.getUniqueNodeCount() + 2 : v );
+            }
+        }
+    }
+}
+
+TEST( GraphToDAG_Tests, convertToDAG_parallel ) {
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    for( size_t scc = 0; scc < 20; scc++ ) { //SCCs of increasing size chained together
+        auto first = scc * 100;
+        for( size_t i = 0; i < scc + 2; i++ ) {
+            g.createDirectedEdge_fast( first + i, first + ( i + 1 ) % ( scc + 2 ) );
+            g.createDirectedEdge_fast( first + i, first + ( i + 2 ) % ( scc + 2 ) );
+        }
+        g.createDirectedEdge_fast( first, first + 100 );
+    }
+    auto found_SCCs = sbp::algo::Tarjan( g ).findSCCs();
+    auto sub_graphs = sbp::algo::PartitionGraph().partitionSCCs( g, *found_SCCs, "Test05_SubGraph" );
+    auto serial     = sbp::algo::GraphToDAG( 1 ).convertToDAG( *sub_graphs, "Test05_DAG" );
+    auto parallel   = sbp::algo::GraphToDAG( 4 ).convertToDAG( *sub_graphs, "Test05_DAG" );
+    ASSERT_EQ( sub_graphs->size(), parallel->size() );
+    ASSERT_EQ( serial->size(), parallel->size() );
+    auto expected = serial->begin();
+    for( auto it = parallel->begin(); it != parallel->end(); ++it, ++expected ) {
+        ASSERT_EQ( expected->_dag.getName(), it->_dag.getName() );
+        ASSERT_EQ( expected->_dag.nodeCount(), it->_dag.nodeCount() );
+        ASSERT_EQ( expected->_dag.size(), it->_dag.size() );
+        ASSERT_EQ( expected->_discovery_times, it->_discovery_times );
+        ASSERT_EQ( expected->_finish_times, it->_finish_times );
+    }
+}
+
 #endif //SUPERBUBBLE_PERFORMANCE_GRAPHTODAG_TEST_H
@@ -0,0 +1,45 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_NODEORDERING_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_NODEORDERING_TEST_H
+
+#include "gtest/gtest.h"
+#include "../src/algorithm/NodeOrdering.h"
+
+TEST( NodeOrdering_Tests, reorder_chain ) {
+    //Chain inserted in scrambled order: a->b->c->d->e
+    auto graph = eadlib::WeightedGraph<std::string>();
+    for( auto kmer : { "a", "e", "c", "b", "d" } ) {
+        graph.addNode( kmer );
+    }
+    graph.createDirectedEdge_fast( "c", "d" );
+    graph.createDirectedEdge_fast( "a", "b" );
+    graph.createDirectedEdge_fast( "d", "e" );
+    graph.createDirectedEdge_fast( "b", "c" );
+    auto before = sbp::algo::NodeOrdering::edgeSpan( graph );
+    auto ordering = sbp::algo::NodeOrdering( graph );
+    ASSERT_TRUE( ordering.reorder() );
+    ASSERT_TRUE( graph.hasDenseNodeIDs() );
+    auto after = sbp::algo::NodeOrdering::edgeSpan( graph );
+    ASSERT_EQ( 1, after._max );
+    ASSERT_DOUBLE_EQ( 1, after._mean );
+    ASSERT_LT( after._mean, before._mean );
+    auto seen = std::vector<bool>( graph.nodeCount(), false );
+    for( const auto &node : graph ) {
+        ASSERT_FALSE( seen[ node.second.id ] );
+        seen[ node.second.id ] = true;
+    }
+}
+
+TEST( NodeOrdering_Tests, reorder_disconnected ) {
+    auto graph = eadlib::WeightedGraph<std::string>();
+    graph.createDirectedEdge_fast( "a", "b" );
+    graph.createDirectedEdge_fast( "x", "y" );
+    graph.createDirectedEdge_fast( "b", "c" );
+    graph.createDirectedEdge_fast( "y", "z" );
+    graph.addNode( "lonely" );
+    auto ordering = sbp::algo::NodeOrdering( graph );
+    ASSERT_TRUE( ordering.reorder() );
+    ASSERT_TRUE( graph.hasDenseNodeIDs() );
+    ASSERT_EQ( 1, sbp::algo::NodeOrdering::edgeSpan( graph )._max );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_NODEORDERING_TEST_H
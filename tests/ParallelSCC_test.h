@@ -0,0 +1,111 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_PARALLELSCC_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_PARALLELSCC_TEST_H
+
+#include "gtest/gtest.h"
+#include <random>
+#include <eadlib/datastructure/WeightedGraph.h>
+#include "../src/algorithm/Tarjan.h"
+#include "../src/algorithm/ParallelSCC.h"
+
+/**
+ * Puts the Tarjan SCCs in the canonical order of ParallelSCC
+ * (singletons first, members sorted, SCCs sorted by their smallest member)
+ */
+inline std::list<std::list<size_t>> canonicalSCCs( std::list<std::list<size_t>> &sccs ) {
+    for( auto &scc : sccs ) {
+        scc.sort();
+    }
+    auto singletons = sccs.front();
+    sccs.pop_front();
+    sccs.sort( []( const std::list<size_t> &a, const std::list<size_t> &b ) { return a.front() < b.front(); } );
+    sccs.push_front( singletons );
+    return sccs;
+}
+
+TEST( ParallelSCC_Tests, SCC1_same_as_Tarjan ) {
+    auto graph = eadlib::WeightedGraph<size_t>( "SCC1_test" );
+    graph.createDirectedEdge_fast( 0, 1 );
+    graph.createDirectedEdge_fast( 1, 2 );
+    graph.createDirectedEdge_fast( 1, 6 );
+    graph.createDirectedEdge_fast( 2, 3 );
+    graph.createDirectedEdge_fast( 2, 7 );
+    graph.createDirectedEdge_fast( 3, 4 );
+    graph.createDirectedEdge_fast( 3, 5 );
+    graph.createDirectedEdge_fast( 4, 5 );
+    graph.createDirectedEdge_fast( 5, 2 );
+    graph.createDirectedEdge_fast( 5, 6 );
+    graph.createDirectedEdge_fast( 6, 7 );
+    graph.createDirectedEdge_fast( 7, 8 );
+    auto expected = sbp::algo::Tarjan( graph ).findSCCs();
+    for( size_t threads = 1; threads <= 4; threads++ ) {
+        auto found = sbp::algo::ParallelSCC( graph, threads ).findSCCs();
+        ASSERT_EQ( canonicalSCCs( *expected ), *found );
+    }
+    auto found = sbp::algo::ParallelSCC( graph, 2 ).findSCCs();
+    ASSERT_EQ( 2, found->size() );
+    ASSERT_EQ( std::list<size_t>( { 0, 1, 6, 7, 8 } ), found->front() );
+    ASSERT_EQ( std::list<size_t>( { 2, 3, 4, 5 } ), found->back() );
+}
+
+TEST( ParallelSCC_Tests, SCC2_self_loop ) {
+    auto g = eadlib::WeightedGraph<size_t>( "SCC2_test" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 2, 0 );
+    g.createDirectedEdge_fast( 3, 3 ); //self-loop (still a singleton SCC)
+    g.createDirectedEdge_fast( 2, 3 );
+    auto sccs = sbp::algo::Tarjan::SCCArray();
+    ASSERT_TRUE( sbp::algo::ParallelSCC( g, 3 ).findSCCs( sccs ) );
+    ASSERT_EQ( 2, sccs.size() );
+    ASSERT_EQ( std::vector<size_t>( { 0, 1, 4 } ), sccs._offsets );
+    ASSERT_EQ( std::vector<size_t>( { 3, 0, 1, 2 } ), sccs._members );
+}
+
+TEST( ParallelSCC_Tests, Random_same_as_Tarjan ) {
+    auto graph  = eadlib::WeightedGraph<size_t>( "Random_test" );
+    auto engine = std::mt19937( 42 );
+    const size_t node_count { 20000 };
+    auto node   = std::uniform_int_distribution<size_t>( 0, node_count - 1 );
+    for( size_t i = 0; i < node_count; i++ ) {
+        graph.addNode( i );
+    }
+    for( size_t i = 0; i < node_count * 5 / 4; i++ ) {
+        graph.createDirectedEdge_fast( node( engine ), node( engine ) );
+    }
+    auto expected = sbp::algo::Tarjan( graph ).findSCCs();
+    canonicalSCCs( *expected );
+    for( size_t threads : { 1, 2, 8 } ) {
+        auto found = sbp::algo::ParallelSCC( graph, threads ).findSCCs();
+        ASSERT_EQ( *expected, *found );
+    }
+}
+
+TEST( ParallelSCC_Tests, Random_streamed_same_as_Tarjan ) {
+    auto graph  = eadlib::WeightedGraph<size_t>( "Random_test" );
+    auto engine = std::mt19937( 7 );
+    const size_t node_count { 20000 };
+    auto node   = std::uniform_int_distribution<size_t>( 0, node_count - 1 );
+    for( size_t i = 0; i < node_count; i++ ) {
+        graph.addNode( i );
+    }
+    for( size_t i = 0; i < node_count * 5 / 4; i++ ) {
+        graph.createDirectedEdge_fast( node( engine ), node( engine ) );
+    }
+    auto expected = sbp::algo::Tarjan( graph ).findSCCs();
+    canonicalSCCs( *expected );
+    for( size_t threads : { 1, 2, 8 } ) {
+        //SCCs come in the order they are found with the singletons last
+        auto found = std::list<std::list<size_t>>( 1 );
+        ASSERT_TRUE( sbp::algo::ParallelSCC( graph, threads ).findSCCs( [&]( const std::list<size_t> &scc, const bool &singletons ) {
+            ASSERT_TRUE( found.front().empty() );
+            if( singletons ) {
+                found.front() = scc;
+            } else {
+                found.emplace_back( scc );
+            }
+        } ) );
+        ASSERT_EQ( *expected, canonicalSCCs( found ) );
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_PARALLELSCC_TEST_H
@@ -1,6 +1,8 @@
 #ifndef SUPERBUBBLE_PERFORMANCE_SUBGRAPH_TEST_H
 #define SUPERBUBBLE_PERFORMANCE_SUBGRAPH_TEST_H
 
+#include <algorithm>
+#include <sstream>
 #include <eadlib/io/FileWriter.h>
 #include "gtest/gtest.h"
 #include "../src/algorithm/PartitionGraph.h"
@@ -64,4 +66,78 @@ TEST( SubGraph_Tests, Constructor02 ) {
     }
 }
 
+TEST( SubGraph_Tests, partitionSCCs_parallel ) {
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 0, 5 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 6 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 5 );
+    g.createDirectedEdge_fast( 4, 1 );
+    g.createDirectedEdge_fast( 5, 6 );
+    g.createDirectedEdge_fast( 6, 7 );
+    g.createDirectedEdge_fast( 7, 8 );
+    g.createDirectedEdge_fast( 8, 7 );
+    g.createDirectedEdge_fast( 8, 9 );
+    auto found_SCCs = sbp::algo::Tarjan( g ).findSCCs();
+    auto sub_graphs = sbp::algo::PartitionGraph( 4 ).partitionSCCs( g, *found_SCCs, "SubGraph" );
+    ASSERT_EQ( found_SCCs->size(), sub_graphs->size() );
+    //Same SubGraphs as when partitioning the SCCs one at a time
+    auto sub_graph = sub_graphs->begin();
+    for( auto scc = found_SCCs->begin(); scc != found_SCCs->end(); ++scc, ++sub_graph ) {
+        auto expected = sbp::algo::PartitionGraph().partition( g, *scc, scc == found_SCCs->begin(), sub_graph->getName() );
+        std::stringstream expected_ss, actual_ss;
+        expected->front().printGlobal( expected_ss );
+        sub_graph->printGlobal( actual_ss );
+        ASSERT_EQ( expected->front().nodeCount(), sub_graph->nodeCount() );
+        ASSERT_EQ( expected->front().size(), sub_graph->size() );
+        ASSERT_EQ( expected_ss.str(), actual_ss.str() );
+    }
+}
+
+TEST( SubGraph_Tests, viewSCCs ) {
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 0, 5 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 6 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 5 );
+    g.createDirectedEdge_fast( 4, 1 );
+    g.createDirectedEdge_fast( 5, 6 );
+    g.createDirectedEdge_fast( 6, 7 );
+    g.createDirectedEdge_fast( 7, 8 );
+    g.createDirectedEdge_fast( 8, 7 );
+    auto found_SCCs = sbp::algo::Tarjan( g ).findSCCs();
+    auto sub_graphs = sbp::algo::PartitionGraph().partitionSCCs( g, *found_SCCs, "SubGraph" );
+    auto views      = sbp::algo::PartitionGraph().viewSCCs( g, *found_SCCs, "SubGraph" );
+    ASSERT_EQ( sub_graphs->size(), views->size() );
+    //Same adjacency as the copied SubGraphs (order aside)
+    auto sorted = []( std::vector<size_t> list ) {
+        std::sort( list.begin(), list.end() );
+        return list;
+    };
+    auto view = views->begin();
+    for( auto sub_graph = sub_graphs->begin(); sub_graph != sub_graphs->end(); ++sub_graph, ++view ) {
+        ASSERT_EQ( sub_graph->getName(), view->getName() );
+        ASSERT_EQ( sub_graph->nodeCount(), view->nodeCount() );
+        for( size_t local = 0; local < sub_graph->nodeCount(); local++ ) {
+            const auto &node = sub_graph->at( local );
+            ASSERT_EQ( sorted( std::vector<size_t>( node.childrenList.begin(), node.childrenList.end() ) ),
+                       sorted( view->at( local ).childrenList ) );
+            ASSERT_EQ( sorted( std::vector<size_t>( node.parentsList.begin(), node.parentsList.end() ) ),
+                       sorted( view->at( local ).parentsList ) );
+            if( local > 1 ) {
+                ASSERT_EQ( sub_graph->getGlobalID( local ), view->getGlobalID( local ) );
+                ASSERT_EQ( local, view->getLocalID( view->getGlobalID( local ) ) );
+            }
+        }
+    }
+}
+
 #endif //SUPERBUBBLE_PERFORMANCE_SUBGRAPH_TEST_H
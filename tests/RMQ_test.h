@@ -0,0 +1,38 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_RMQ_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_RMQ_TEST_H
+
+#include "gtest/gtest.h"
+#include <random>
+#include "../src/algorithm/superbubble/container/RMQ.h"
+
+TEST( RMQ_Tests, query ) {
+    std::mt19937 generator( 1 );
+    for( size_t size : { 1, 5, 63, 64, 65, 200, 1000 } ) {
+        auto values = std::vector<size_t>( size );
+        for( auto &value : values ) {
+            value = generator() % 100;
+        }
+        auto range_min = sbp::algo::container::RangeMin( values );
+        auto range_max = sbp::algo::container::RangeMax( values );
+        ASSERT_EQ( size, range_min.size() );
+        for( size_t from = 0; from < size; from++ ) {
+            auto min = values[ from ];
+            auto max = values[ from ];
+            for( size_t to = from; to < size; to++ ) {
+                min = std::min( min, values[ to ] );
+                max = std::max( max, values[ to ] );
+                ASSERT_EQ( min, range_min.query( from, to ) );
+                ASSERT_EQ( max, range_max.query( from, to ) );
+            }
+        }
+    }
+}
+
+TEST( RMQ_Tests, query_fail ) {
+    auto range_min = sbp::algo::container::RangeMin( std::vector<size_t>( { 3, 1, 2 } ) );
+    ASSERT_THROW( range_min.query( 2, 1 ), std::out_of_range );
+    ASSERT_THROW( range_min.query( 0, 3 ), std::out_of_range );
+    ASSERT_THROW( sbp::algo::container::RangeMax().query( 0, 0 ), std::out_of_range );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_RMQ_TEST_H
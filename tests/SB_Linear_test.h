@@ -2,7 +2,9 @@
 #define SUPERBUBBLE_PERFORMANCE_SB_LINEAR_TEST_H
 
 #include "gtest/gtest.h"
+#include <set>
 #include "../src/algorithm/superbubble/SB_Linear.h"
+#include "SuperBubble_test.h"
 
 TEST( SB_Linear_Tests, Topological_ordering ) {
     auto g = eadlib::WeightedGraph<size_t>( "Graph" );
@@ -39,7 +41,7 @@ TEST( SB_Linear_Tests, Topological_ordering ) {
         }
         std::cout << std::endl;
 
-        auto candidate_list = std::list<std::shared_ptr<sbp::algo::SB_Linear::Candidate>>();
+        auto candidate_list = std::vector<std::shared_ptr<sbp::algo::SB_Linear::Candidate>>();
         auto pvsEntrance    = std::vector<std::shared_ptr<sbp::algo::SB_Linear::Candidate>>( it->_dag.nodeCount() );
         linear.generateCandidateList( it->_dag, invOrd, candidate_list, pvsEntrance );
 
@@ -58,4 +60,72 @@ TEST( SB_Linear_Tests, Topological_ordering ) {
 
 }
 
+TEST( SB_Linear_Tests, Topological_ordering_implicit ) {
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 0, 5 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 6 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 5 );
+    g.createDirectedEdge_fast( 4, 1 );
+    g.createDirectedEdge_fast( 5, 6 );
+    g.createDirectedEdge_fast( 6, 7 );
+    auto found_SCCs = sbp::algo::Tarjan( g ).findSCCs();
+    auto sub_graphs = sbp::algo::PartitionGraph().partitionSCCs( g, *found_SCCs, "SubGraph" );
+    auto linear     = sbp::algo::SB_Linear( g );
+    for( const auto &sub_graph : *sub_graphs ) {
+        auto explicit_dag = sbp::algo::GraphToDAG().convert( sub_graph, "DAG" );
+        auto implicit_dag = sbp::algo::GraphToDAG().convertImplicit( sub_graph, "DAG" );
+        std::vector<size_t> explicit_invOrd, implicit_invOrd;
+        std::vector<size_t> explicit_ordD( explicit_dag->front()._dag.nodeCount() );
+        std::vector<size_t> implicit_ordD( implicit_dag->_dag.nodeCount() );
+        linear.fillTopologicalOrder( explicit_dag->front()._dag, explicit_invOrd, explicit_ordD );
+        linear.fillTopologicalOrder( implicit_dag->_dag, implicit_invOrd, implicit_ordD );
+        ASSERT_EQ( explicit_invOrd, implicit_invOrd );
+        ASSERT_EQ( explicit_ordD, implicit_ordD );
+    }
+}
+
+TEST( SB_Linear_Tests, Topological_ordering_large_SCC ) {
+    //One SCC long enough to overflow the call stack with a recursive DFS
+    const size_t node_count = 500000;
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    for( size_t i = 0; i < node_count; i++ ) {
+        g.createDirectedEdge_fast( i, ( i + 1 ) % node_count );
+    }
+    auto found_SCCs = sbp::algo::Tarjan( g ).findSCCs();
+    ASSERT_EQ( 2, found_SCCs->size() );
+    auto sub_graphs = sbp::algo::PartitionGraph().viewSCCs( g, *found_SCCs, "SubGraph" );
+    auto dag_pack   = sbp::algo::GraphToDAG().convertImplicit( sub_graphs->back(), "DAG" );
+    const auto &dag = dag_pack->_dag;
+    ASSERT_EQ( 2 * node_count + 2, dag.nodeCount() );
+    ASSERT_EQ( node_count, dag_pack->_discovery_times.at( 2 ) ); //DFS from local node 3 (no r) reaches 2 last
+    std::vector<size_t> invOrd;
+    std::vector<size_t> ordD( dag.nodeCount() );
+    auto linear = sbp::algo::SB_Linear( g );
+    linear.fillTopologicalOrder( dag, invOrd, ordD );
+    ASSERT_EQ( dag.nodeCount(), invOrd.size() );
+    for( size_t v = 0; v < dag.nodeCount(); v++ ) {
+        for( auto child : dag.at( v ).childrenList ) {
+            ASSERT_LT( ordD.at( v ), ordD.at( child ) );
+        }
+    }
+}
+
+TEST( SB_Linear_Tests, run_closed_SCC ) {
+    //No edge comes into the SCC {0,3,4}: the DFS starts inside it and 4->0 becomes the back edge 4->0'
+    //so (4,0) is found across the two copies of the DAG
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 4, 0 );
+    g.createDirectedEdge_fast( 0, 3 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 3, 1 );
+    g.createDirectedEdge_fast( 3, 2 );
+    auto expected = std::set<std::pair<size_t, size_t>>( { { 0, 3 }, { 4, 0 } } );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Linear>( g ) );
+}
+
 #endif //SUPERBUBBLE_PERFORMANCE_SB_LINEAR_TEST_H
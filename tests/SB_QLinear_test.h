@@ -0,0 +1,46 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_SB_QLINEAR_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_SB_QLINEAR_TEST_H
+
+#include "gtest/gtest.h"
+#include <set>
+#include "../src/algorithm/superbubble/SB_QLinear.h"
+#include "SuperBubble_test.h"
+
+TEST( SB_QLinear_Tests, run_checkpointed ) {
+    auto checkpoint = sbp::io::Checkpoint( "SB_QLinear_test", "0123456789abcdef" );
+    checkpoint.clear();
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 5 );
+    g.createDirectedEdge_fast( 5, 1 );
+    g.createDirectedEdge_fast( 5, 6 );
+    g.createDirectedEdge_fast( 6, 7 );
+    g.createDirectedEdge_fast( 6, 8 );
+    g.createDirectedEdge_fast( 7, 9 );
+    g.createDirectedEdge_fast( 8, 9 );
+    auto expected = std::set<std::pair<size_t, size_t>>( { { 1, 4 }, { 4, 5 }, { 6, 9 } } );
+    //first run computes and checkpoints each stage, second run resumes from the DAGs
+    for( auto stage : { sbp::io::Checkpoint::Stage::NONE, sbp::io::Checkpoint::Stage::DAG_PACKAGES } ) {
+        ASSERT_EQ( stage, checkpoint.latest() );
+        ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_QLinear>( g, checkpoint ) );
+    }
+    checkpoint.clear();
+}
+
+TEST( SB_QLinear_Tests, run_checkpointed_fail ) {
+    //nothing to resume from and no SCCs to find: the run fails and nothing is checkpointed
+    auto checkpoint = sbp::io::Checkpoint( "SB_QLinear_test", "0123456789abcdef" );
+    checkpoint.clear();
+    auto g            = eadlib::WeightedGraph<size_t>( "Graph" );
+    auto superbubbles = std::list<sbp::algo::container::SuperBubble>();
+    ASSERT_FALSE( sbp::algo::SB_QLinear( g, checkpoint ).run( superbubbles ) );
+    ASSERT_TRUE( superbubbles.empty() );
+    ASSERT_EQ( sbp::io::Checkpoint::Stage::NONE, checkpoint.latest() );
+    checkpoint.clear();
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_SB_QLINEAR_TEST_H
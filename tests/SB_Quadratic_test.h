@@ -0,0 +1,28 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_SB_QUADRATIC_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_SB_QUADRATIC_TEST_H
+
+#include "gtest/gtest.h"
+#include "../src/algorithm/superbubble/SB_Quadratic.h"
+
+TEST( SB_Quadratic_Tests, run_closed_SCC ) {
+    //No edge comes into the SCC {1,2,3,4}: (4,1) is still a superbubble
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 1 );
+    auto superbubbles = std::list<sbp::algo::container::SuperBubble>();
+    ASSERT_TRUE( sbp::algo::SB_Quadratic( g ).run( superbubbles ) );
+    ASSERT_EQ( 1, superbubbles.size() );
+    ASSERT_EQ( 4, superbubbles.front()._in_id );
+    ASSERT_EQ( 1, superbubbles.front()._out_id );
+}
+
+TEST( SB_Quadratic_Tests, run_fail ) {
+    auto g            = eadlib::WeightedGraph<size_t>( "Graph" );
+    auto superbubbles = std::list<sbp::algo::container::SuperBubble>();
+    ASSERT_FALSE( sbp::algo::SB_Quadratic( g ).run( superbubbles ) );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_SB_QUADRATIC_TEST_H
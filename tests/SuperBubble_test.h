@@ -0,0 +1,109 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_SUPERBUBBLE_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_SUPERBUBBLE_TEST_H
+
+#include "gtest/gtest.h"
+#include <random>
+#include <set>
+#include "../src/algorithm/superbubble/SB_Linear.h"
+#include "../src/algorithm/superbubble/SB_QLinear.h"
+#include "../src/algorithm/superbubble/SB_Dominators.h"
+#include "../src/algorithm/superbubble/SB_Quadratic.h"
+
+/**
+ * Runs a superbubble algorithm on a graph
+ * @param graph Graph
+ * @param args  Other arguments of the algorithm's constructor
+ * @return (entrance, exit) pairs of the SuperBubbles found (each expected to be found once)
+ */
+template<class Algorithm, class... Args> std::set<std::pair<size_t, size_t>> findSuperBubbles( const eadlib::WeightedGraph<size_t> &graph,
+                                                                                              const Args &... args ) {
+    auto superbubbles = std::list<sbp::algo::container::SuperBubble>();
+    auto found        = std::set<std::pair<size_t, size_t>>();
+    EXPECT_TRUE( Algorithm( graph, args... ).run( superbubbles ) );
+    for( auto sb : superbubbles ) {
+        found.emplace( sb._in_id, sb._out_id );
+    }
+    EXPECT_EQ( found.size(), superbubbles.size() );
+    return found;
+}
+
+TEST( SuperBubble_Tests, run_DAG ) {
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 0, 2 );
+    g.createDirectedEdge_fast( 1, 3 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 5 );
+    g.createDirectedEdge_fast( 4, 6 );
+    g.createDirectedEdge_fast( 5, 7 );
+    g.createDirectedEdge_fast( 6, 7 );
+    g.createDirectedEdge_fast( 7, 8 );
+    auto expected = std::set<std::pair<size_t, size_t>>( { { 0, 3 }, { 3, 4 }, { 4, 7 }, { 7, 8 } } );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Linear>( g ) );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_QLinear>( g ) );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Dominators>( g ) );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Quadratic>( g ) );
+}
+
+TEST( SuperBubble_Tests, run_SCC ) {
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 5 );
+    g.createDirectedEdge_fast( 5, 1 );
+    g.createDirectedEdge_fast( 5, 6 );
+    //(1,4) and (4,5) are in the SCC {1,2,3,4,5} and found in both copies of the DAG but reported once
+    auto expected = std::set<std::pair<size_t, size_t>>( { { 1, 4 }, { 4, 5 } } );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Linear>( g ) );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_QLinear>( g ) );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Dominators>( g ) );
+    ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Quadratic>( g ) );
+}
+
+TEST( SuperBubble_Tests, run_cycle_exit_to_entrance ) {
+    //1->{2,3}->4 closes a cycle with 4->1 so (1,4) is not acyclic
+    auto g = eadlib::WeightedGraph<size_t>( "Graph" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 1, 3 );
+    g.createDirectedEdge_fast( 2, 4 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 1 );
+    g.createDirectedEdge_fast( 4, 5 );
+    ASSERT_TRUE( findSuperBubbles<sbp::algo::SB_Linear>( g ).empty() );
+    ASSERT_TRUE( findSuperBubbles<sbp::algo::SB_QLinear>( g ).empty() );
+    ASSERT_TRUE( findSuperBubbles<sbp::algo::SB_Dominators>( g ).empty() );
+    ASSERT_TRUE( findSuperBubbles<sbp::algo::SB_Quadratic>( g ).empty() );
+}
+
+TEST( SuperBubble_Tests, run_same_as_SB_Quadratic ) {
+    //Same superbubbles on DAGs and on cyclic graphs
+    auto generator = std::mt19937( 1 );
+    for( size_t i = 0; i < 1000; i++ ) {
+        auto acyclic    = i % 2 == 0;
+        auto node_count = std::uniform_int_distribution<size_t>( 2, 16 )( generator );
+        auto node       = std::uniform_int_distribution<size_t>( 0, node_count - 2 );
+        auto edge_count = std::uniform_int_distribution<size_t>( 1, 2 * node_count )( generator );
+        auto g          = eadlib::WeightedGraph<size_t>( "Graph" );
+        for( size_t e = 0; e < edge_count; e++ ) {
+            auto from = node( generator );
+            auto to   = std::uniform_int_distribution<size_t>( acyclic ? from + 1 : 0, node_count - 1 )( generator );
+            if( from != to ) {
+                g.createDirectedEdge_fast( from, to );
+            }
+        }
+        if( g.isEmpty() ) {
+            continue;
+        }
+        auto expected = findSuperBubbles<sbp::algo::SB_Quadratic>( g );
+        ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Linear>( g ) ) << "graph #" << i;
+        ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_QLinear>( g ) ) << "graph #" << i;
+        ASSERT_EQ( expected, findSuperBubbles<sbp::algo::SB_Dominators>( g ) ) << "graph #" << i;
+    }
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_SUPERBUBBLE_TEST_H
@@ -2,6 +2,7 @@
 #define SUPERBUBBLE_PERFORMANCE_TARJAN_TEST_H
 
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <eadlib/datastructure/WeightedGraph.h>
 #include "../src/algorithm/Tarjan.h"
 
@@ -65,4 +66,103 @@ TEST( Tarjan_Tests, SCC2_concatenate ) {
     ASSERT_TRUE( strongly_connected_components->empty() );
 }
 
+TEST( Tarjan_Tests, SCC3_flat ) {
+    auto g = eadlib::WeightedGraph<size_t>( "SCC3_test" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 2, 0 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 3 );
+    g.createDirectedEdge_fast( 4, 5 );
+    auto sccs = sbp::algo::Tarjan::SCCArray();
+    ASSERT_TRUE( sbp::algo::Tarjan( g ).findSCCs( sccs ) );
+    ASSERT_EQ( 3, sccs.size() );
+    ASSERT_EQ( 6, sccs._members.size() );
+    ASSERT_EQ( std::vector<size_t>( { 0, 1, 3, 6 } ), sccs._offsets );
+    ASSERT_EQ( 5, sccs._members.at( 0 ) ); //Singletons
+    auto scc1 = std::vector<size_t>( sccs._members.begin() + 1, sccs._members.begin() + 3 );
+    auto scc2 = std::vector<size_t>( sccs._members.begin() + 3, sccs._members.end() );
+    std::sort( scc1.begin(), scc1.end() );
+    std::sort( scc2.begin(), scc2.end() );
+    if( scc1.size() > scc2.size() ) {
+        std::swap( scc1, scc2 );
+    }
+    ASSERT_EQ( std::vector<size_t>( { 3, 4 } ), scc1 );
+    ASSERT_EQ( std::vector<size_t>( { 0, 1, 2 } ), scc2 );
+}
+
+TEST( Tarjan_Tests, SCC4_no_singletons ) {
+    auto g = eadlib::WeightedGraph<size_t>( "SCC4_test" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 2, 0 );
+    auto strongly_connected_components = sbp::algo::Tarjan( g ).findSCCs();
+    ASSERT_EQ( 2, strongly_connected_components->size() );
+    ASSERT_TRUE( strongly_connected_components->front().empty() ); //No singletons
+    strongly_connected_components->back().sort();
+    ASSERT_EQ( strongly_connected_components->back(), std::list<size_t>( { 0, 1, 2 } ) );
+}
+
+TEST( Tarjan_Tests, SCC5_long_path ) {
+    const size_t length { 1000000 };
+    auto g = eadlib::WeightedGraph<size_t>( "SCC5_test" );
+    for( size_t i = 0; i + 1 < length; i++ ) {
+        g.createDirectedEdge_fast( i, i + 1 );
+    }
+    g.createDirectedEdge_fast( length - 1, length / 2 ); //cycle over the 2nd half
+    auto sccs = sbp::algo::Tarjan::SCCArray();
+    ASSERT_TRUE( sbp::algo::Tarjan( g ).findSCCs( sccs ) );
+    ASSERT_EQ( 2, sccs.size() );
+    ASSERT_EQ( length / 2, sccs._offsets.at( 1 ) );
+    ASSERT_EQ( length, sccs._offsets.at( 2 ) );
+}
+
+TEST( Tarjan_Tests, SCC6_trimmed ) {
+    auto g = eadlib::WeightedGraph<size_t>( "SCC6_test" );
+    g.createDirectedEdge_fast( 0, 1 ); //tail in
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 2, 3 ); //cycle
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 2 );
+    g.createDirectedEdge_fast( 4, 5 ); //path between the cycles
+    g.createDirectedEdge_fast( 5, 6 );
+    g.createDirectedEdge_fast( 6, 6 ); //self-loop (not trimmed but still a singleton)
+    g.createDirectedEdge_fast( 6, 7 );
+    g.createDirectedEdge_fast( 7, 8 ); //cycle (no exit)
+    g.createDirectedEdge_fast( 8, 7 );
+    auto sccs = sbp::algo::Tarjan::SCCArray();
+    ASSERT_TRUE( sbp::algo::Tarjan( g ).findSCCs( sccs ) );
+    ASSERT_EQ( 3, sccs.size() );
+    auto singletons = std::vector<size_t>( sccs._members.begin(), sccs._members.begin() + sccs._offsets.at( 1 ) );
+    std::sort( singletons.begin(), singletons.end() );
+    ASSERT_EQ( std::vector<size_t>( { 0, 1, 5, 6 } ), singletons );
+}
+
+TEST( Tarjan_Tests, SCC7_streamed ) {
+    auto g = eadlib::WeightedGraph<size_t>( "SCC7_test" );
+    g.createDirectedEdge_fast( 0, 1 );
+    g.createDirectedEdge_fast( 1, 2 );
+    g.createDirectedEdge_fast( 2, 0 );
+    g.createDirectedEdge_fast( 2, 3 );
+    g.createDirectedEdge_fast( 3, 4 );
+    g.createDirectedEdge_fast( 4, 3 );
+    g.createDirectedEdge_fast( 4, 5 );
+    auto expected = sbp::algo::Tarjan( g ).findSCCs();
+    auto streamed = std::list<std::list<size_t>>();
+    bool singletons_last { false };
+    auto callback = [&]( const std::list<size_t> &scc, const bool &singletons ) {
+        ASSERT_FALSE( singletons_last );
+        if( singletons ) {
+            streamed.emplace_front( scc );
+            singletons_last = true;
+        } else {
+            streamed.emplace_back( scc );
+        }
+    };
+    ASSERT_TRUE( sbp::algo::Tarjan( g ).findSCCs( callback ) );
+    ASSERT_TRUE( singletons_last );
+    ASSERT_EQ( *expected, streamed );
+}
+
 #endif //SUPERBUBBLE_PERFORMANCE_TARJAN_TEST_H
@@ -0,0 +1,51 @@
+#ifndef SUPERBUBBLE_PERFORMANCE_WEAKCOMPONENTS_TEST_H
+#define SUPERBUBBLE_PERFORMANCE_WEAKCOMPONENTS_TEST_H
+
+#include "gtest/gtest.h"
+#include <eadlib/datastructure/WeightedGraph.h>
+#include "../src/algorithm/WeakComponents.h"
+
+TEST( WeakComponents_Tests, findWCCs ) {
+    auto g = eadlib::WeightedGraph<size_t>( "WCC_test" );
+    g.createDirectedEdge_fast( 0, 4 );
+    g.createDirectedEdge_fast( 4, 2 );
+    g.createDirectedEdge_fast( 6, 2 ); //joined by the direction-less union
+    g.createDirectedEdge_fast( 1, 3 );
+    g.createDirectedEdge_fast( 3, 1 );
+    g.addNode( 5 );
+    auto components = sbp::algo::WeakComponents( g );
+    ASSERT_TRUE( components.findWCCs() );
+    ASSERT_EQ( 3, components.size() );
+    ASSERT_EQ( std::vector<size_t>( { 0, 2, 4, 6 } ), components.getNodes( 0 ) );
+    ASSERT_EQ( std::vector<size_t>( { 1, 3 } ), components.getNodes( 1 ) );
+    ASSERT_EQ( std::vector<size_t>( { 5 } ), components.getNodes( 2 ) );
+}
+
+TEST( WeakComponents_Tests, extract ) {
+    auto g = eadlib::WeightedGraph<size_t>( "WCC_test" );
+    g.createDirectedEdge_fast( 0, 4, 3 );
+    g.createDirectedEdge_fast( 4, 2, 1 );
+    g.createDirectedEdge_fast( 6, 2, 2 );
+    g.createDirectedEdge_fast( 1, 3, 5 );
+    g.addNode( 5 );
+    auto components = sbp::algo::WeakComponents( g );
+    ASSERT_TRUE( components.findWCCs() );
+    auto component = eadlib::WeightedGraph<size_t>( "Component0" );
+    ASSERT_TRUE( components.extract( 0, component ) );
+    //local IDs: 0->0, 2->1, 4->2, 6->3
+    ASSERT_EQ( 4, component.nodeCount() );
+    ASSERT_EQ( 6, component.size() ); //weighted edge count
+    ASSERT_TRUE( component.edgeExists( 0, 2 ) );
+    ASSERT_TRUE( component.edgeExists( 2, 1 ) );
+    ASSERT_TRUE( component.edgeExists( 3, 1 ) );
+    ASSERT_EQ( 3, component.at( 0 ).weight.at( 2 ) );
+    ASSERT_EQ( 2, component.at( 3 ).weight.at( 1 ) );
+    auto isolated = eadlib::WeightedGraph<size_t>( "Component2" );
+    ASSERT_TRUE( components.extract( 2, isolated ) );
+    ASSERT_EQ( 1, isolated.nodeCount() );
+    ASSERT_EQ( 0, isolated.size() );
+    auto out_of_range = eadlib::WeightedGraph<size_t>( "Component3" );
+    ASSERT_FALSE( components.extract( 3, out_of_range ) );
+}
+
+#endif //SUPERBUBBLE_PERFORMANCE_WEAKCOMPONENTS_TEST_H
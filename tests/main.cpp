@@ -1,8 +1,21 @@
 #include "Tarjan_test.h"
+#include "ParallelSCC_test.h"
+#include "WeakComponents_test.h"
 #include "PartitionGraph_test.h"
 #include "GraphToDAG_test.h"
+#include "SuperBubble_test.h"
 #include "SB_Linear_test.h"
+#include "SB_QLinear_test.h"
+#include "SB_Quadratic_test.h"
+#include "RMQ_test.h"
 #include "Timer_test.h"
+#include "GraphSnapshot_test.h"
+#include "AdjacencyCodec_test.h"
+#include "GraphCompressor_test.h"
+#include "NodeOrdering_test.h"
+#include "Fingerprint_test.h"
+#include "Checkpoint_test.h"
+#include "Database_test.h"
 
 #include "gtest/gtest.h"
 